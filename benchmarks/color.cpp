@@ -0,0 +1,96 @@
+#include "common.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+    // the straightforward per channel std::pow version the tables replace
+    float decodePow(std::uint8_t c) {
+        const float x = float(c) / 255.0f;
+        return x <= 0.04045f ? x / 12.92f : std::pow((x + 0.055f) / 1.055f, 2.4f);
+    }
+
+    std::uint8_t encodePow(float v) {
+        v = std::clamp(v, 0.0f, 1.0f);
+        const float x = v <= 0.0031308f ? v * 12.92f : 1.055f * std::pow(v, 1.0f / 2.4f) - 0.055f;
+        return std::uint8_t(x * 255.0f + 0.5f);
+    }
+
+    constexpr std::int64_t pixelCount = 1 << 16;
+}
+
+// ---------- sRGB decode: pow vs table ----------
+static void BM_SrgbDecodePow(benchmark::State& state) {
+    const auto px = bench::pixels(std::size_t(state.range(0)), 42);
+    std::vector<Vector4<float>> out(px.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < px.size(); ++i)
+            out[i] = {float(px[i].a) / 255.0f, decodePow(px[i].r), decodePow(px[i].g), decodePow(px[i].b)};
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SrgbDecodeTable(benchmark::State& state) {
+    const auto px = bench::pixels(std::size_t(state.range(0)), 42);
+    std::vector<Vector4<float>> out(px.size());
+    for (auto _ : state) {
+        srgb::decode(px, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SrgbDecodePow)->Arg(pixelCount);
+BENCHMARK(BM_SrgbDecodeTable)->Arg(pixelCount);
+
+// ---------- sRGB encode: pow vs table ----------
+static void BM_SrgbEncodePow(benchmark::State& state) {
+    const auto linear = bench::linearPixels(std::size_t(state.range(0)), 42);
+    std::vector<Color> out(linear.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < linear.size(); ++i)
+            out[i] = {encodePow(linear[i].x), encodePow(linear[i].y), encodePow(linear[i].z), std::uint8_t(linear[i].w * 255.0f + 0.5f)};
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SrgbEncodeTable(benchmark::State& state) {
+    const auto linear = bench::linearPixels(std::size_t(state.range(0)), 42);
+    std::vector<Color> out(linear.size());
+    for (auto _ : state) {
+        srgb::encode(linear, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SrgbEncodePow)->Arg(pixelCount);
+BENCHMARK(BM_SrgbEncodeTable)->Arg(pixelCount);
+
+// ---------- HSV / HSL round trips ----------
+static void BM_HsvRoundTrip(benchmark::State& state) {
+    auto px = bench::pixels(std::size_t(state.range(0)), 42);
+    std::vector<Hsv> hsv(px.size());
+    for (auto _ : state) {
+        toHsv(px, hsv);
+        fromHsv(hsv, px);
+        benchmark::DoNotOptimize(px.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_HslRoundTrip(benchmark::State& state) {
+    auto px = bench::pixels(std::size_t(state.range(0)), 42);
+    std::vector<Hsl> hsl(px.size());
+    for (auto _ : state) {
+        toHsl(px, hsl);
+        fromHsl(hsl, px);
+        benchmark::DoNotOptimize(px.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_HsvRoundTrip)->Arg(pixelCount);
+BENCHMARK(BM_HslRoundTrip)->Arg(pixelCount);
@@ -0,0 +1,112 @@
+/**
+ * @file common.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Shared inputs and batch size sweep of the microbenchmarks
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Type.hpp"
+
+namespace bench {
+
+    // Batches that stay in L1, in L2 and that stream from memory (Vector3<double>: 1.5 KiB, 96 KiB, 6 MiB).
+    inline void batchSizes(benchmark::internal::Benchmark* b) {
+        for (std::int64_t n : {64, 4096, 262144})
+            b->Arg(n);
+    }
+
+    template <typename T>
+    std::vector<Vector2<T>> vectors2(std::size_t n, unsigned seed, T lo = T(-100), T hi = T(100)) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> u(lo, hi);
+        std::vector<Vector2<T>> v(n);
+        for (auto& p : v)
+            p = {u(rng), u(rng)};
+        return v;
+    }
+
+    template <typename T>
+    std::vector<Vector3<T>> vectors3(std::size_t n, unsigned seed, T lo = T(-100), T hi = T(100)) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> u(lo, hi);
+        std::vector<Vector3<T>> v(n);
+        for (auto& p : v)
+            p = {u(rng), u(rng), u(rng)};
+        return v;
+    }
+
+    template <typename T>
+    std::vector<Quaternion<T>> rotations(std::size_t n, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> u(T(-1), T(1));
+        std::vector<Quaternion<T>> q(n);
+        for (auto& r : q) {
+            r = Quaternion<T>(u(rng), u(rng), u(rng), u(rng));
+            r.normalize();
+        }
+        return q;
+    }
+
+    template <typename T>
+    std::vector<Matrix<T, 4, 4>> matrices(std::size_t n, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> u(T(-1), T(1));
+        std::vector<Matrix<T, 4, 4>> m(n);
+        for (auto& a : m)
+            for (auto& row : a.data)
+                for (auto& x : row)
+                    x = u(rng);
+        return m;
+    }
+
+    template <typename T>
+    std::vector<Rect<T>> rects(std::size_t n, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> position(T(-100), T(100)), size(T(1), T(40));
+        std::vector<Rect<T>> r(n);
+        for (auto& rect : r)
+            rect = {position(rng), position(rng), size(rng), size(rng)};
+        return r;
+    }
+
+    // triangles around the origin, so about half of the points fall inside
+    template <typename T>
+    std::vector<Triangle<T>> triangles(std::size_t n, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> u(T(-1), T(1));
+        std::vector<Triangle<T>> tri(n);
+        for (auto& t : tri)
+            t = {{T(-100) + u(rng), T(-100) + u(rng)}, {T(100) + u(rng), T(-100) + u(rng)}, {u(rng), T(100) + u(rng)}};
+        return tri;
+    }
+
+    inline std::vector<Color> pixels(std::size_t n, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::vector<Color> px(n);
+        for (Color& c : px)
+            c = {std::uint8_t(rng()), std::uint8_t(rng()), std::uint8_t(rng()), std::uint8_t(rng())};
+        return px;
+    }
+
+    // pixels(n, seed) decoded to linear RGBA
+    inline std::vector<Vector4<float>> linearPixels(std::size_t n, unsigned seed) {
+        std::vector<Vector4<float>> linear(n);
+        srgb::decode(pixels(n, seed), linear);
+        return linear;
+    }
+
+    // items = elements processed, bytes = `bytesPerItem` moved per element
+    inline void setThroughput(benchmark::State& state, std::size_t bytesPerItem) {
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * std::int64_t(bytesPerItem));
+    }
+
+} // namespace bench
@@ -0,0 +1,196 @@
+#include "common.hpp"
+
+namespace {
+    template <std::size_t N>
+    Matrix<double, N, N> makeMatrix() {
+        Matrix<double, N, N> m{};
+        for (std::size_t i = 0; i < N; ++i)
+            for (std::size_t j = 0; j < N; ++j)
+                m.data[i][j] = double((i * 7 + j * 3) % 5) - 2.0 + (i == j ? double(N) : 0.0);
+        return m;
+    }
+
+    Matrix4x4 makeAffine() {
+        Matrix4x4 m = makeMatrix<4>();
+        m.data[3][0] = m.data[3][1] = m.data[3][2] = 0.0;
+        m.data[3][3] = 1.0;
+        return m;
+    }
+}
+
+// ---------- Determinant: closed form vs LU ----------
+template <std::size_t N>
+static void BM_DeterminantClosedForm(benchmark::State& state) {
+    auto m = makeMatrix<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(m.determinant());
+    }
+}
+
+template <std::size_t N>
+static void BM_DeterminantLU(benchmark::State& state) {
+    auto m = makeMatrix<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(m.lu().determinant());
+    }
+}
+
+BENCHMARK(BM_DeterminantClosedForm<2>);
+BENCHMARK(BM_DeterminantLU<2>);
+BENCHMARK(BM_DeterminantClosedForm<3>);
+BENCHMARK(BM_DeterminantLU<3>);
+BENCHMARK(BM_DeterminantClosedForm<4>);
+BENCHMARK(BM_DeterminantLU<4>);
+
+// ---------- Inverse: closed form vs LU ----------
+template <std::size_t N>
+static void BM_InverseClosedForm(benchmark::State& state) {
+    auto m = makeMatrix<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        auto inv = m.inverse();
+        benchmark::DoNotOptimize(inv);
+    }
+}
+
+template <std::size_t N>
+static void BM_InverseLU(benchmark::State& state) {
+    auto m = makeMatrix<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        auto inv = m.lu().inverse();
+        benchmark::DoNotOptimize(inv);
+    }
+}
+
+BENCHMARK(BM_InverseClosedForm<2>);
+BENCHMARK(BM_InverseLU<2>);
+BENCHMARK(BM_InverseClosedForm<3>);
+BENCHMARK(BM_InverseLU<3>);
+BENCHMARK(BM_InverseClosedForm<4>);
+BENCHMARK(BM_InverseLU<4>);
+
+static void BM_InverseAffine(benchmark::State& state) {
+    auto m = makeAffine();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        auto inv = m.inverseAffine();
+        benchmark::DoNotOptimize(inv);
+    }
+}
+BENCHMARK(BM_InverseAffine);
+
+// ---------- Element-wise chain: eager vs lazy ----------
+template <std::size_t N>
+static void BM_ChainEager(benchmark::State& state) {
+    auto a = makeMatrix<N>(), b = makeMatrix<N>(), c = makeMatrix<N>();
+    Matrix<double, N, N> r{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        r = a + b * 0.5 - c;
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+template <std::size_t N>
+static void BM_ChainLazy(benchmark::State& state) {
+    auto a = makeMatrix<N>(), b = makeMatrix<N>(), c = makeMatrix<N>();
+    Matrix<double, N, N> r{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        assign(r, lazy(a) + lazy(b) * 0.5 - c);
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+BENCHMARK(BM_ChainEager<4>);
+BENCHMARK(BM_ChainLazy<4>);
+BENCHMARK(BM_ChainEager<16>);
+BENCHMARK(BM_ChainLazy<16>);
+BENCHMARK(BM_ChainEager<64>);
+BENCHMARK(BM_ChainLazy<64>);
+
+// ---------- Batched 4x4: product, transpose, transform ----------
+template <typename T>
+static void BM_Matrix4Multiply(benchmark::State& state) {
+    const auto a = bench::matrices<T>(std::size_t(state.range(0)), 1);
+    const auto b = bench::matrices<T>(std::size_t(state.range(0)), 2);
+    std::vector<Matrix<T, 4, 4>> out(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 3 * sizeof(Matrix<T, 4, 4>));
+}
+
+template <typename T>
+static void BM_Matrix4Transpose(benchmark::State& state) {
+    const auto a = bench::matrices<T>(std::size_t(state.range(0)), 1);
+    std::vector<Matrix<T, 4, 4>> out(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i].transpose();
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Matrix<T, 4, 4>));
+}
+
+// one matrix, a batch of homogeneous vectors
+template <typename T>
+static void BM_Matrix4TimesVector(benchmark::State& state) {
+    const auto m = bench::matrices<T>(1, 1)[0];
+    const auto points = bench::vectors3<T>(std::size_t(state.range(0)), 2);
+    std::vector<Vector4<T>> in(points.size()), out(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+        in[i] = {points[i].x, points[i].y, points[i].z, T(1)};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < in.size(); ++i)
+            out[i] = m * in[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector4<T>));
+}
+
+// same work through the AoS and SoA transformPoints kernels
+template <typename T>
+static void BM_TransformPoints(benchmark::State& state) {
+    const auto m = bench::matrices<T>(1, 1)[0];
+    const auto points = bench::vectors3<T>(std::size_t(state.range(0)), 2);
+    std::vector<Vector3<T>> out(points.size());
+    for (auto _ : state) {
+        transformPoints(m, std::span<const Vector3<T>>(points), std::span<Vector3<T>>(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<T>));
+}
+
+template <typename T>
+static void BM_TransformPointsSoA(benchmark::State& state) {
+    const auto m = bench::matrices<T>(1, 1)[0];
+    const Vector3Array<T> points(bench::vectors3<T>(std::size_t(state.range(0)), 2));
+    Vector3Array<T> out(points.size());
+    for (auto _ : state) {
+        transformPoints(m, points, out);
+        benchmark::DoNotOptimize(out.lane(0));
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<T>));
+}
+
+BENCHMARK_TEMPLATE(BM_Matrix4Multiply, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Matrix4Multiply, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Matrix4Transpose, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Matrix4Transpose, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Matrix4TimesVector, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Matrix4TimesVector, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_TransformPoints, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_TransformPoints, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_TransformPointsSoA, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_TransformPointsSoA, double)->Apply(bench::batchSizes);
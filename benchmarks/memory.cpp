@@ -0,0 +1,65 @@
+#include "common.hpp"
+
+#include <memory_resource>
+#include <set>
+#include <vector>
+
+namespace {
+    struct Less {
+        bool operator()(const Vector2f& a, const Vector2f& b) const { return a.x < b.x || (a.x == b.x && a.y < b.y); }
+    };
+}
+
+// ---------- Per frame triangulation: default heap vs arena ----------
+static void BM_DelaunayFrameHeap(benchmark::State& state) {
+    const auto points = bench::vectors2<double>(std::size_t(state.range(0)), 42);
+    for (auto _ : state) {
+        const Delaunay<double> d(points);
+        const auto triangles = d.triangles();
+        benchmark::DoNotOptimize(triangles.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_DelaunayFrameArena(benchmark::State& state) {
+    const auto points = bench::vectors2<double>(std::size_t(state.range(0)), 42);
+    MonotonicArena arena;
+    for (auto _ : state) {
+        {
+            const Delaunay<double> d(points, &arena);
+            const auto triangles = d.triangles(&arena);
+            benchmark::DoNotOptimize(triangles.data());
+        }
+        arena.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_DelaunayFrameHeap)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_DelaunayFrameArena)->Arg(1000)->Arg(100000);
+
+// ---------- Node containers: default heap vs pool ----------
+static void BM_SetFrameHeap(benchmark::State& state) {
+    const auto points = bench::vectors2<double>(std::size_t(state.range(0)), 42);
+    for (auto _ : state) {
+        std::set<Vector2f, Less> set(points.begin(), points.end());
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SetFramePool(benchmark::State& state) {
+    const auto points = bench::vectors2<double>(std::size_t(state.range(0)), 42);
+    FixedPool pool;
+    for (auto _ : state) {
+        {
+            std::pmr::set<Vector2f, Less> set(points.begin(), points.end(), Less{}, &pool);
+            benchmark::DoNotOptimize(set.size());
+        }
+        pool.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SetFrameHeap)->Arg(10000);
+BENCHMARK(BM_SetFramePool)->Arg(10000);
@@ -0,0 +1,38 @@
+#include "common.hpp"
+
+#include <numeric>
+#include <span>
+
+// ---------- Kernels split on the thread pool, range(1) threads ----------
+static void BM_ParallelTransformPoints(benchmark::State& state) {
+    const auto m = bench::matrices<double>(1, 1)[0];
+    const auto points = bench::vectors3<double>(std::size_t(state.range(0)), 2);
+    std::vector<Vector3<double>> out(points.size());
+    const std::span<const Vector3<double>> in(points);
+    const std::span<Vector3<double>> result(out);
+    for (auto _ : state) {
+        parallel_for(0, points.size(), [&](std::size_t first, std::size_t last) {
+            transformPoints(m, in.subspan(first, last - first), result.subspan(first, last - first));
+        }, unsigned(state.range(1)));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<double>));
+}
+
+static void BM_ParallelReduceSum(benchmark::State& state) {
+    const auto points = bench::vectors3<double>(std::size_t(state.range(0)), 1);
+    for (auto _ : state) {
+        const double sum = parallel_reduce(0, points.size(), 0.0, [&](std::size_t first, std::size_t last) {
+            double s = 0.0;
+            for (std::size_t i = first; i < last; ++i)
+                s += points[i].magnitude();
+            return s;
+        }, [](double a, double b) { return a + b; }, unsigned(state.range(1)), 4096);
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::setThroughput(state, sizeof(Vector3<double>));
+}
+
+BENCHMARK(BM_ParallelTransformPoints)->ArgsProduct({{4096, 262144, 2097152}, {1, 2, 4}})->UseRealTime();
+BENCHMARK(BM_ParallelReduceSum)->ArgsProduct({{262144, 2097152}, {1, 2, 4}})->UseRealTime();
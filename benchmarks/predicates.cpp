@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+#include "Type.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+    // Random triples, `jitter` == 0 gives well separated points, otherwise the third point
+    // lies within `jitter` of the line through the first two.
+    std::vector<double> makeTriples(std::size_t n, double jitter) {
+        std::mt19937_64 rng(42);
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        std::vector<double> v(n * 6);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            double* p = &v[i * 6];
+            for (std::size_t k = 0; k < 4; ++k)
+                p[k] = u(rng);
+            if (jitter == 0.0) {
+                p[4] = u(rng);
+                p[5] = u(rng);
+            } else {
+                const double t = u(rng);
+                p[4] = p[0] + t * (p[2] - p[0]) + jitter * u(rng);
+                p[5] = p[1] + t * (p[3] - p[1]) + jitter * u(rng);
+            }
+        }
+        return v;
+    }
+
+    // Quads on the unit circle, the fourth point pushed off it by up to `jitter`.
+    std::vector<double> makeQuads(std::size_t n, double jitter) {
+        std::mt19937_64 rng(7);
+        std::uniform_real_distribution<double> angle(0.0, 6.283185307179586);
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        std::vector<double> v(n * 8);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            double* p = &v[i * 8];
+            for (std::size_t k = 0; k < 4; ++k) {
+                const double a = angle(rng);
+                const double r = k == 3 ? 1.0 + jitter * u(rng) : 1.0;
+                p[2 * k] = r * std::cos(a);
+                p[2 * k + 1] = r * std::sin(a);
+            }
+        }
+        return v;
+    }
+
+    constexpr std::size_t count = 4096;
+}
+
+// ---------- orient2d ----------
+// Arg: 0 random, 1 jitter 1e-12, 2 exactly on the line (rounded)
+static double jitterOf(std::int64_t arg) { return arg == 0 ? 0.0 : arg == 1 ? 1e-12 : 1e-300; }
+
+static void BM_Orient2dNaive(benchmark::State& state) {
+    const auto v = makeTriples(count, jitterOf(state.range(0)));
+    for (auto _ : state)
+        for (std::size_t i = 0; i < count; ++i) {
+            const double* p = &v[i * 6];
+            benchmark::DoNotOptimize((p[0] - p[4]) * (p[3] - p[5]) - (p[1] - p[5]) * (p[2] - p[4]));
+        }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * count));
+}
+
+static void BM_Orient2dAdaptive(benchmark::State& state) {
+    const auto v = makeTriples(count, jitterOf(state.range(0)));
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const double* p = &v[i * 6];
+        double det;
+        hits += predicates::orient2dFilter(p[0], p[1], p[2], p[3], p[4], p[5], det);
+    }
+
+    for (auto _ : state)
+        for (std::size_t i = 0; i < count; ++i) {
+            const double* p = &v[i * 6];
+            benchmark::DoNotOptimize(predicates::orient2d(p[0], p[1], p[2], p[3], p[4], p[5]));
+        }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * count));
+    state.counters["filter_hit_rate"] = double(hits) / double(count);
+}
+
+BENCHMARK(BM_Orient2dNaive)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK(BM_Orient2dAdaptive)->Arg(0)->Arg(1)->Arg(2);
+
+// ---------- incircle ----------
+// Arg: 0 random, 1 jitter 1e-12, 2 cocircular (rounded)
+static double circleJitterOf(std::int64_t arg) { return arg == 0 ? 0.5 : arg == 1 ? 1e-12 : 0.0; }
+
+static void BM_IncircleNaive(benchmark::State& state) {
+    const auto v = makeQuads(count, circleJitterOf(state.range(0)));
+    for (auto _ : state)
+        for (std::size_t i = 0; i < count; ++i) {
+            const double* p = &v[i * 8];
+            const double adx = p[0] - p[6], ady = p[1] - p[7];
+            const double bdx = p[2] - p[6], bdy = p[3] - p[7];
+            const double cdx = p[4] - p[6], cdy = p[5] - p[7];
+            benchmark::DoNotOptimize((adx * adx + ady * ady) * (bdx * cdy - cdx * bdy)
+                                   + (bdx * bdx + bdy * bdy) * (cdx * ady - adx * cdy)
+                                   + (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady));
+        }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * count));
+}
+
+static void BM_IncircleAdaptive(benchmark::State& state) {
+    const auto v = makeQuads(count, circleJitterOf(state.range(0)));
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const double* p = &v[i * 8];
+        double det;
+        hits += predicates::incircleFilter(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], det);
+    }
+
+    for (auto _ : state)
+        for (std::size_t i = 0; i < count; ++i) {
+            const double* p = &v[i * 8];
+            benchmark::DoNotOptimize(predicates::incircle(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]));
+        }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * count));
+    state.counters["filter_hit_rate"] = double(hits) / double(count);
+}
+
+BENCHMARK(BM_IncircleNaive)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK(BM_IncircleAdaptive)->Arg(0)->Arg(1)->Arg(2);
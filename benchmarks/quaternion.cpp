@@ -0,0 +1,52 @@
+#include "common.hpp"
+
+// ---------- Quaternion ----------
+template <typename T>
+static void BM_QuaternionMultiply(benchmark::State& state) {
+    const auto a = bench::rotations<T>(std::size_t(state.range(0)), 1);
+    const auto b = bench::rotations<T>(std::size_t(state.range(0)), 2);
+    std::vector<Quaternion<T>> out(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 3 * sizeof(Quaternion<T>));
+}
+
+// one rotation applied point by point
+template <typename T>
+static void BM_QuaternionRotate(benchmark::State& state) {
+    const Quaternion<T> q = bench::rotations<T>(1, 1)[0];
+    const auto points = bench::vectors3<T>(std::size_t(state.range(0)), 2);
+    std::vector<Vector3<T>> out(points.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); ++i)
+            out[i] = q.rotate(points[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<T>));
+}
+
+// same through the span overload (matrix + vectorised transformPoints)
+template <typename T>
+static void BM_QuaternionRotateBatch(benchmark::State& state) {
+    const Quaternion<T> q = bench::rotations<T>(1, 1)[0];
+    const auto points = bench::vectors3<T>(std::size_t(state.range(0)), 2);
+    std::vector<Vector3<T>> out(points.size());
+    for (auto _ : state) {
+        q.rotate(points, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<T>));
+}
+
+BENCHMARK_TEMPLATE(BM_QuaternionMultiply, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_QuaternionMultiply, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_QuaternionRotate, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_QuaternionRotate, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_QuaternionRotateBatch, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_QuaternionRotateBatch, double)->Apply(bench::batchSizes);
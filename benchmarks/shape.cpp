@@ -0,0 +1,69 @@
+#include "common.hpp"
+
+// ---------- Rect ----------
+template <typename T>
+static void BM_RectIntersects(benchmark::State& state) {
+    const auto a = bench::rects<T>(std::size_t(state.range(0)), 1);
+    const auto b = bench::rects<T>(std::size_t(state.range(0)), 2);
+    std::vector<std::uint8_t> out(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i].intersects(b[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Rect<T>) + 1);
+}
+
+BENCHMARK_TEMPLATE(BM_RectIntersects, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_RectIntersects, double)->Apply(bench::batchSizes);
+
+// ---------- Triangle ----------
+template <typename T>
+static void BM_TriangleIsInside(benchmark::State& state) {
+    const auto triangles = bench::triangles<T>(std::size_t(state.range(0)), 1);
+    const auto points = bench::vectors2<T>(std::size_t(state.range(0)), 2);
+    std::vector<std::uint8_t> out(points.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); ++i)
+            out[i] = triangles[i].isInside(points[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, sizeof(Triangle<T>) + sizeof(Vector2<T>) + 1);
+}
+
+// one triangle against a batch of points, filtered SIMD path (PointLocation.hpp)
+template <typename T>
+static void BM_InsideTriangleBatch(benchmark::State& state) {
+    const Triangle<T> triangle = bench::triangles<T>(1, 1)[0];
+    const auto points = bench::vectors2<T>(std::size_t(state.range(0)), 2);
+    const Vector2Array<T> soa(points);
+    std::vector<std::uint8_t> out(points.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(insideTriangle(triangle, soa, std::span<std::uint8_t>(out)));
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, sizeof(Vector2<T>) + 1);
+}
+
+template <typename T>
+static void BM_TriangleIsInsideCircumcircle(benchmark::State& state) {
+    const auto triangles = bench::triangles<T>(std::size_t(state.range(0)), 1);
+    const auto points = bench::vectors2<T>(std::size_t(state.range(0)), 2);
+    std::vector<std::uint8_t> out(points.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); ++i)
+            out[i] = triangles[i].isInsideCircumcircle(points[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, sizeof(Triangle<T>) + sizeof(Vector2<T>) + 1);
+}
+
+BENCHMARK_TEMPLATE(BM_TriangleIsInside, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_TriangleIsInside, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_InsideTriangleBatch, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_InsideTriangleBatch, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_TriangleIsInsideCircumcircle, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_TriangleIsInsideCircumcircle, double)->Apply(bench::batchSizes);
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+#include "Type.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+    using Hierarchy = TransformHierarchy<double>;
+
+    constexpr std::size_t nodeCount = 500000;
+
+    // one root, depth first, depth wandering around a few dozen levels
+    Hierarchy makeScene(std::size_t n) {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        Hierarchy h;
+        h.reserve(n);
+        std::vector<Hierarchy::Index> path;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!path.empty())
+                path.resize(path.size() - std::min<std::size_t>(path.size() - 1, rng() % 3));
+            Quaterniond q(u(rng), u(rng), u(rng), u(rng));
+            q.normalize();
+            path.push_back(h.add(path.empty() ? Hierarchy::none : path.back(), q, {u(rng), u(rng), u(rng)}, {1, 1, 1}));
+        }
+        h.update(1);
+        return h;
+    }
+
+    // what the hierarchy replaces: every world matrix recomputed every frame
+    void recomputeAll(const Hierarchy& h, std::vector<Matrix4x4>& world) {
+        for (Hierarchy::Index i = 0; i < h.size(); ++i)
+            world[i] = h.parent(i) == Hierarchy::none ? h.local(i) : world[h.parent(i)] * h.local(i);
+    }
+}
+
+// ---------- Transform hierarchy ----------
+static void BM_HierarchyRecomputeAll(benchmark::State& state) {
+    const Hierarchy h = makeScene(nodeCount);
+    std::vector<Matrix4x4> world(h.size());
+    for (auto _ : state) {
+        recomputeAll(h, world);
+        benchmark::DoNotOptimize(world.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::int64_t(h.size()));
+}
+
+// every node dirty (root moved), range(0) threads
+static void BM_HierarchyUpdateAll(benchmark::State& state) {
+    Hierarchy h = makeScene(nodeCount);
+    for (auto _ : state) {
+        h.setTranslation(0, {0, 0, 0});
+        h.update(unsigned(state.range(0)));
+        benchmark::DoNotOptimize(&h.world(Hierarchy::Index(h.size() - 1)));
+    }
+    state.SetItemsProcessed(state.iterations() * std::int64_t(h.size()));
+}
+
+// range(0) nodes moved per frame, single threaded
+static void BM_HierarchyUpdateSparse(benchmark::State& state) {
+    Hierarchy h = makeScene(nodeCount);
+    std::mt19937 rng(7);
+    for (auto _ : state) {
+        for (std::int64_t k = 0; k < state.range(0); ++k)
+            h.setTranslation(Hierarchy::Index(1 + rng() % (h.size() - 1)), {0, 1, 0});
+        h.update(1);
+        benchmark::DoNotOptimize(&h.world(Hierarchy::Index(h.size() - 1)));
+    }
+    state.SetItemsProcessed(state.iterations() * std::int64_t(h.size()));
+}
+
+BENCHMARK(BM_HierarchyRecomputeAll)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_HierarchyUpdateAll)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_HierarchyUpdateSparse)->Arg(10)->Arg(1000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,99 @@
+#include "common.hpp"
+
+// ---------- Arithmetic (AoS) ----------
+template <typename T>
+static void BM_Vector3Axpy(benchmark::State& state) {
+    const auto a = bench::vectors3<T>(std::size_t(state.range(0)), 1);
+    const auto b = bench::vectors3<T>(std::size_t(state.range(0)), 2);
+    std::vector<Vector3<T>> out(a.size());
+    const T s = T(0.5);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i] + b[i] * s;
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 3 * sizeof(Vector3<T>));
+}
+
+template <typename T>
+static void BM_Vector3Dot(benchmark::State& state) {
+    const auto a = bench::vectors3<T>(std::size_t(state.range(0)), 1);
+    const auto b = bench::vectors3<T>(std::size_t(state.range(0)), 2);
+    std::vector<T> out(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i].dot(b[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<T>) + sizeof(T));
+}
+
+template <typename T>
+static void BM_Vector3Cross(benchmark::State& state) {
+    const auto a = bench::vectors3<T>(std::size_t(state.range(0)), 1);
+    const auto b = bench::vectors3<T>(std::size_t(state.range(0)), 2);
+    std::vector<Vector3<T>> out(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i].cross(b[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 3 * sizeof(Vector3<T>));
+}
+
+template <typename T>
+static void BM_Vector3Normalize(benchmark::State& state) {
+    const auto a = bench::vectors3<T>(std::size_t(state.range(0)), 1);
+    std::vector<Vector3<T>> out(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i].normalized();
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<T>));
+}
+
+BENCHMARK_TEMPLATE(BM_Vector3Axpy, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3Axpy, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3Dot, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3Dot, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3Cross, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3Cross, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3Normalize, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3Normalize, double)->Apply(bench::batchSizes);
+
+// ---------- Batched kernels (SoA) ----------
+template <typename T>
+static void BM_Vector3ArrayDot(benchmark::State& state) {
+    const auto a = bench::vectors3<T>(std::size_t(state.range(0)), 1);
+    const auto b = bench::vectors3<T>(std::size_t(state.range(0)), 2);
+    const Vector3Array<T> sa(a), sb(b);
+    std::vector<T> out(a.size());
+    for (auto _ : state) {
+        sa.dot(sb, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<T>) + sizeof(T));
+}
+
+template <typename T>
+static void BM_Vector3ArrayNormalize(benchmark::State& state) {
+    const Vector3Array<T> a(bench::vectors3<T>(std::size_t(state.range(0)), 1));
+    Vector3Array<T> out(a.size());
+    for (auto _ : state) {
+        a.normalized(out);
+        benchmark::DoNotOptimize(out.lane(0));
+        benchmark::ClobberMemory();
+    }
+    bench::setThroughput(state, 2 * sizeof(Vector3<T>));
+}
+
+BENCHMARK_TEMPLATE(BM_Vector3ArrayDot, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3ArrayDot, double)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3ArrayNormalize, float)->Apply(bench::batchSizes);
+BENCHMARK_TEMPLATE(BM_Vector3ArrayNormalize, double)->Apply(bench::batchSizes);
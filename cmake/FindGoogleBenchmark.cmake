@@ -0,0 +1,17 @@
+# cmake/FindGoogleBenchmark.cmake
+
+if(NOT TARGET benchmark::benchmark)
+    find_package(benchmark CONFIG QUIET)
+endif()
+
+if(NOT TARGET benchmark::benchmark)
+    include(FetchContent)
+    FetchContent_Declare(
+        googlebenchmark
+        GIT_REPOSITORY https://github.com/google/benchmark.git
+        GIT_TAG        main
+    )
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    FetchContent_MakeAvailable(googlebenchmark)
+endif()
@@ -0,0 +1,42 @@
+# Runs the benchmark executable and writes its results to <OUTPUT_DIR>/<commit>.json, so runs
+# of two commits can be compared with Google Benchmark's tools/compare.py:
+#   compare.py benchmarks <OUTPUT_DIR>/<old>.json <OUTPUT_DIR>/<new>.json
+#
+# cmake -DBENCHMARK=<executable> -DSOURCE_DIR=<repository> -DOUTPUT_DIR=<dir> [-DFILTER=<regex>] -P RunBenchmarks.cmake
+
+if(NOT FILTER)
+    set(FILTER ".")
+endif()
+
+# short hash of HEAD, "-dirty" when the working tree has local changes
+set(COMMIT "unknown")
+find_package(Git QUIET)
+if(GIT_FOUND)
+    execute_process(COMMAND ${GIT_EXECUTABLE} rev-parse --short HEAD
+        WORKING_DIRECTORY ${SOURCE_DIR}
+        OUTPUT_VARIABLE HEAD_COMMIT OUTPUT_STRIP_TRAILING_WHITESPACE
+        RESULT_VARIABLE GIT_RESULT ERROR_QUIET)
+    if(GIT_RESULT EQUAL 0)
+        set(COMMIT ${HEAD_COMMIT})
+        execute_process(COMMAND ${GIT_EXECUTABLE} diff --quiet HEAD --
+            WORKING_DIRECTORY ${SOURCE_DIR}
+            RESULT_VARIABLE GIT_DIRTY ERROR_QUIET)
+        if(NOT GIT_DIRTY EQUAL 0)
+            set(COMMIT "${COMMIT}-dirty")
+        endif()
+    endif()
+endif()
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+set(OUTPUT "${OUTPUT_DIR}/${COMMIT}.json")
+
+execute_process(COMMAND ${BENCHMARK}
+        --benchmark_filter=${FILTER}
+        --benchmark_out=${OUTPUT}
+        --benchmark_out_format=json
+        --benchmark_context=commit=${COMMIT}
+    RESULT_VARIABLE BENCHMARK_RESULT)
+if(NOT BENCHMARK_RESULT EQUAL 0)
+    message(FATAL_ERROR "${BENCHMARK} failed (${BENCHMARK_RESULT})")
+endif()
+message(STATUS "Benchmark results written to ${OUTPUT}")
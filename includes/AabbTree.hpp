@@ -0,0 +1,565 @@
+/**
+ * @file AabbTree.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Dynamic bounding volume tree over moving Rects (insert / remove / move, queries, ray casts)
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Shape.hpp"
+#include "Vector2.hpp"
+
+/**
+ * @brief dynamic AABB tree (Box2D style)
+ *
+ * - leaves hold "fat" boxes, the Rect grown by `margin` (and by the predicted displacement
+ *   on moves), so small motions do not touch the tree,
+ * - a leaf is inserted next to the sibling that grows the total perimeter the least,
+ * - every node on the path back to the root is rotated when the heights of its children
+ *   differ by more than one. Like Box2D this is not a strict AVL invariant (a rotation can
+ *   leave a grandchild unbalanced), but it keeps the height, and so queries, in O(log n).
+ *
+ * Nodes live in one vector with a free list: proxies are stable indices, no pointer chasing
+ * through separate allocations. Queries report fat boxes, callers refine with the exact shape.
+ */
+template <typename T>
+class AabbTree {
+    static_assert(std::is_arithmetic<T>::value, "AabbTree needs an arithmetic coordinate type");
+
+    public:
+        using Proxy = std::uint32_t;
+        static constexpr Proxy none = std::numeric_limits<Proxy>::max();
+
+        // Fat boxes are stretched by this many times the displacement given to move().
+        static constexpr T displacementFactor = T(4);
+
+        explicit AabbTree(T margin = T(0)) : _margin(margin) {}
+
+        // ---------- Proxies ----------
+        // Adds `rect` to the tree, `data` is stored with it (e.g. an entity or triangle index).
+        Proxy insert(const Rect<T>& rect, std::uint32_t data = 0) {
+            const Proxy proxy = allocate();
+            Node& n = _nodes[proxy];
+            n.box = fatten(box(rect));
+            n.data = data;
+            n.height = 0;
+            insertLeaf(proxy);
+            ++_proxies;
+            return proxy;
+        }
+
+        void remove(Proxy proxy) {
+            removeLeaf(proxy);
+            release(proxy);
+            --_proxies;
+        }
+
+        /**
+         * @brief updates the box of `proxy`
+         *
+         * Nothing happens while the fat box still contains `rect` (and is not much larger than
+         * needed). Otherwise the leaf is re-inserted with a box grown by the margin and
+         * stretched along `displacement`.
+         *
+         * @return true when the tree was modified
+         */
+        bool move(Proxy proxy, const Rect<T>& rect, const Vector2<T>& displacement = {T(0), T(0)}) {
+            const Box tight = box(rect);
+            Box fat = fatten(tight);
+            const T d[2] = {displacementFactor * displacement.x, displacementFactor * displacement.y};
+            for (std::size_t k = 0; k < 2; ++k) {
+                if (d[k] < T(0))
+                    fat.lo[k] += d[k];
+                else
+                    fat.hi[k] += d[k];
+            }
+
+            const Box& current = _nodes[proxy].box;
+            if (current.contains(tight)) {
+                // Still valid, unless a past displacement left it much larger than needed.
+                Box huge = fat;
+                for (std::size_t k = 0; k < 2; ++k) {
+                    huge.lo[k] -= T(4) * _margin;
+                    huge.hi[k] += T(4) * _margin;
+                }
+                if (huge.contains(current))
+                    return false;
+            }
+
+            removeLeaf(proxy);
+            _nodes[proxy].box = fat;
+            insertLeaf(proxy);
+            return true;
+        }
+
+        std::uint32_t data(Proxy proxy) const { return _nodes[proxy].data; }
+
+        Rect<T> fatRect(Proxy proxy) const {
+            const Box& b = _nodes[proxy].box;
+            return {(b.lo[0] + b.hi[0]) / T(2), (b.lo[1] + b.hi[1]) / T(2), b.hi[0] - b.lo[0], b.hi[1] - b.lo[1]};
+        }
+
+        /**
+         * @brief rebuilds every internal node top-down from the current leaves
+         *
+         * Incremental insertion depends on the insertion order. For a set that is built once and
+         * queried many times (static geometry, point location) splitting with the binned surface
+         * area heuristic (perimeter in 2D) overlaps far less. Proxies and fat boxes are kept.
+         */
+        void rebuild() {
+            if (_root == none)
+                return;
+
+            std::vector<Proxy> leaves;
+            leaves.reserve(_proxies);
+            std::vector<Proxy> stack{_root};
+            while (!stack.empty()) {
+                const Proxy i = stack.back();
+                stack.pop_back();
+                if (_nodes[i].leaf()) {
+                    leaves.push_back(i);
+                } else {
+                    stack.push_back(_nodes[i].child1);
+                    stack.push_back(_nodes[i].child2);
+                    release(i);
+                }
+            }
+            _root = build(leaves.data(), leaves.size(), none, 0);
+        }
+
+        // ---------- Queries ----------
+        /**
+         * @brief calls `callback(proxy)` for every fat box overlapping `region`
+         *
+         * Overlap follows Rect::intersects (touching counts). The callback returns false to stop.
+         */
+        template <typename Callback>
+        void query(const Rect<T>& region, Callback&& callback) const {
+            const Box r = box(region);
+            traverse([&](Proxy i) { return _nodes[i].box.overlaps(r); }, [&](Proxy i) { return callback(i); });
+        }
+
+        /**
+         * @brief casts the segment p1 + t (p2 - p1), t in [0, maxFraction], through the tree
+         *
+         * `callback(proxy, maxFraction)` is called for every fat box the segment crosses and
+         * returns the new maximum fraction:
+         * - 0 stops the cast,
+         * - a value in (0, maxFraction) clips the segment (e.g. the fraction of an exact hit),
+         * - maxFraction continues unchanged, a negative value ignores the proxy.
+         */
+        template <typename Callback, typename U = T, typename = typename std::enable_if<std::is_floating_point<U>::value>::type>
+        void rayCast(const Vector2<T>& p1, const Vector2<T>& p2, Callback&& callback, T maxFraction = T(1)) const {
+            const T rx = p2.x - p1.x, ry = p2.y - p1.y;
+            const T length = std::sqrt(rx * rx + ry * ry);
+            if (length <= T(0))
+                return;
+
+            // |v . (p1 - c)| > |v| . h means the segment line misses the box (v normal to r).
+            const T vx = -ry / length, vy = rx / length;
+            const T avx = std::abs(vx), avy = std::abs(vy);
+
+            auto segmentBox = [&](T fraction) {
+                const T tx = p1.x + fraction * rx, ty = p1.y + fraction * ry;
+                return Box{{std::min(p1.x, tx), std::min(p1.y, ty)}, {std::max(p1.x, tx), std::max(p1.y, ty)}};
+            };
+            Box bounds = segmentBox(maxFraction);
+
+            traverse(
+                [&](Proxy i) {
+                    const Box& b = _nodes[i].box;
+                    if (!b.overlaps(bounds))
+                        return false;
+                    const T cx = (b.lo[0] + b.hi[0]) / T(2), cy = (b.lo[1] + b.hi[1]) / T(2);
+                    const T hx = (b.hi[0] - b.lo[0]) / T(2), hy = (b.hi[1] - b.lo[1]) / T(2);
+                    return std::abs(vx * (p1.x - cx) + vy * (p1.y - cy)) - (avx * hx + avy * hy) <= T(0);
+                },
+                [&](Proxy i) {
+                    const T value = callback(i, maxFraction);
+                    if (value == T(0))
+                        return false;
+                    if (value > T(0) && value < maxFraction) {
+                        maxFraction = value;
+                        bounds = segmentBox(maxFraction);
+                    }
+                    return true;
+                });
+        }
+
+        // ---------- Inspection ----------
+        std::size_t size() const { return _proxies; }
+        bool empty() const { return _proxies == 0; }
+
+        // Height of the root, 0 for a single leaf.
+        int height() const { return _root == none ? 0 : _nodes[_root].height; }
+
+        // Checks parent links, heights and box enclosure of the whole tree.
+        bool validate() const { return _root == none || (_nodes[_root].parent == none && validate(_root)); }
+
+    private:
+        struct Box {
+            T lo[2];
+            T hi[2];
+
+            bool overlaps(const Box& o) const {
+                return !(hi[0] < o.lo[0] || lo[0] > o.hi[0] || hi[1] < o.lo[1] || lo[1] > o.hi[1]);
+            }
+
+            bool contains(const Box& o) const {
+                return lo[0] <= o.lo[0] && lo[1] <= o.lo[1] && o.hi[0] <= hi[0] && o.hi[1] <= hi[1];
+            }
+
+            T perimeter() const { return T(2) * ((hi[0] - lo[0]) + (hi[1] - lo[1])); }
+
+            static Box merge(const Box& a, const Box& b) {
+                return {{std::min(a.lo[0], b.lo[0]), std::min(a.lo[1], b.lo[1])},
+                        {std::max(a.hi[0], b.hi[0]), std::max(a.hi[1], b.hi[1])}};
+            }
+        };
+
+        struct Node {
+            Box box;
+            Proxy parent;   // next free node while on the free list
+            Proxy child1;   // none for leaves
+            Proxy child2;
+            int height;     // 0 for leaves, -1 while free
+            std::uint32_t data;
+
+            bool leaf() const { return child1 == none; }
+        };
+
+        // Same bounds as Rect::intersects: x -/+ w / 2.
+        static Box box(const Rect<T>& r) {
+            return {{r.x - r.w / T(2), r.y - r.h / T(2)}, {r.x + r.w / T(2), r.y + r.h / T(2)}};
+        }
+
+        Box fatten(Box b) const {
+            for (std::size_t k = 0; k < 2; ++k) {
+                b.lo[k] -= _margin;
+                b.hi[k] += _margin;
+            }
+            return b;
+        }
+
+        // ---------- Node pool ----------
+        Proxy allocate() {
+            Proxy i;
+            if (_free != none) {
+                i = _free;
+                _free = _nodes[i].parent;
+            } else {
+                i = Proxy(_nodes.size());
+                _nodes.push_back({});
+            }
+            Node& n = _nodes[i];
+            n.parent = n.child1 = n.child2 = none;
+            n.height = 0;
+            return i;
+        }
+
+        void release(Proxy i) {
+            _nodes[i].parent = _free;
+            _nodes[i].height = -1;
+            _free = i;
+        }
+
+        // ---------- Traversal ----------
+        // Depth first walk: `enter(node)` prunes subtrees, `visit(leaf)` returns false to stop.
+        template <typename Enter, typename Visit>
+        void traverse(Enter&& enter, Visit&& visit) const {
+            if (_root == none)
+                return;
+
+            // The stack never holds more than height + 1 entries.
+            Proxy local[128];
+            std::vector<Proxy> spill;
+            Proxy* stack = local;
+            if (std::size_t(height()) + 2 > std::size(local)) {
+                spill.resize(std::size_t(height()) + 2);
+                stack = spill.data();
+            }
+
+            std::size_t top = 0;
+            stack[top++] = _root;
+            while (top > 0) {
+                const Proxy i = stack[--top];
+                if (!enter(i))
+                    continue;
+
+                const Node& n = _nodes[i];
+                if (n.leaf()) {
+                    if (!visit(i))
+                        return;
+                } else {
+                    stack[top++] = n.child1;
+                    stack[top++] = n.child2;
+                }
+            }
+        }
+
+        // ---------- Structure ----------
+        void insertLeaf(Proxy leaf) {
+            if (_root == none) {
+                _root = leaf;
+                _nodes[leaf].parent = none;
+                return;
+            }
+
+            // Descend towards the sibling with the lowest perimeter cost.
+            const Box leafBox = _nodes[leaf].box;
+            Proxy index = _root;
+            while (!_nodes[index].leaf()) {
+                const Node& n = _nodes[index];
+                const T area = n.box.perimeter();
+                const T combined = Box::merge(n.box, leafBox).perimeter();
+
+                // cost of making a new parent for this node and the leaf
+                const T cost = T(2) * combined;
+                // minimum cost pushed down to the children
+                const T inheritance = T(2) * (combined - area);
+
+                auto descend = [&](Proxy child) {
+                    const Node& c = _nodes[child];
+                    const T merged = Box::merge(leafBox, c.box).perimeter();
+                    return (c.leaf() ? merged : merged - c.box.perimeter()) + inheritance;
+                };
+                const T cost1 = descend(n.child1);
+                const T cost2 = descend(n.child2);
+
+                if (cost < cost1 && cost < cost2)
+                    break;
+                index = cost1 < cost2 ? n.child1 : n.child2;
+            }
+
+            const Proxy sibling = index;
+            const Proxy oldParent = _nodes[sibling].parent;
+            const Proxy newParent = allocate();
+            {
+                Node& p = _nodes[newParent];
+                p.parent = oldParent;
+                p.box = Box::merge(leafBox, _nodes[sibling].box);
+                p.height = _nodes[sibling].height + 1;
+                p.child1 = sibling;
+                p.child2 = leaf;
+            }
+            if (oldParent != none) {
+                Node& op = _nodes[oldParent];
+                (op.child1 == sibling ? op.child1 : op.child2) = newParent;
+            } else {
+                _root = newParent;
+            }
+            _nodes[sibling].parent = newParent;
+            _nodes[leaf].parent = newParent;
+
+            refit(_nodes[leaf].parent);
+        }
+
+        /*
+         * Builds the subtree over `leaves[0, count)` and returns its root. The split sorts leaf
+         * centres into 16 bins along the wider axis and keeps the boundary with the lowest
+         * count * perimeter on both sides; flat centre ranges, splits leaving a side empty and
+         * very deep branches fall back to a median split.
+         */
+        Proxy build(Proxy* leaves, std::size_t count, Proxy parent, int depth) {
+            if (count == 1) {
+                _nodes[leaves[0]].parent = parent;
+                return leaves[0];
+            }
+
+            // centres doubled (lo + hi) to stay exact for integer coordinates
+            double lo[2] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+            double hi[2] = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+            auto centre = [&](Proxy i, std::size_t k) { return double(_nodes[i].box.lo[k]) + double(_nodes[i].box.hi[k]); };
+            for (std::size_t i = 0; i < count; ++i) {
+                for (std::size_t k = 0; k < 2; ++k) {
+                    lo[k] = std::min(lo[k], centre(leaves[i], k));
+                    hi[k] = std::max(hi[k], centre(leaves[i], k));
+                }
+            }
+            const std::size_t axis = hi[1] - lo[1] > hi[0] - lo[0] ? 1 : 0;
+
+            constexpr std::size_t binCount = 16;
+            std::size_t mid = 0;
+            if (hi[axis] > lo[axis] && depth < 64) {
+                const double scale = double(binCount) / (hi[axis] - lo[axis]);
+                auto binOf = [&](Proxy i) {
+                    return std::min(std::size_t((centre(i, axis) - lo[axis]) * scale), binCount - 1);
+                };
+
+                Box boxes[binCount];
+                std::size_t counts[binCount] = {};
+                for (std::size_t i = 0; i < count; ++i) {
+                    const std::size_t b = binOf(leaves[i]);
+                    boxes[b] = counts[b]++ ? Box::merge(boxes[b], _nodes[leaves[i]].box) : _nodes[leaves[i]].box;
+                }
+
+                // cost of splitting after bin b: right side accumulated first, then swept from the left
+                double rightCost[binCount];
+                Box acc{};
+                std::size_t n = 0;
+                for (std::size_t b = binCount - 1; b > 0; --b) {
+                    if (counts[b])
+                        acc = n ? Box::merge(acc, boxes[b]) : boxes[b];
+                    n += counts[b];
+                    rightCost[b - 1] = n ? double(n) * double(acc.perimeter()) : 0.0;
+                }
+
+                double best = std::numeric_limits<double>::max();
+                std::size_t split = binCount;
+                n = 0;
+                for (std::size_t b = 0; b + 1 < binCount; ++b) {
+                    if (counts[b])
+                        acc = n ? Box::merge(acc, boxes[b]) : boxes[b];
+                    n += counts[b];
+                    const double cost = double(n) * double(n ? acc.perimeter() : T(0)) + rightCost[b];
+                    if (n > 0 && n < count && cost < best) {
+                        best = cost;
+                        split = b;
+                    }
+                }
+
+                if (split < binCount)
+                    mid = std::size_t(std::partition(leaves, leaves + count, [&](Proxy i) { return binOf(i) <= split; }) - leaves);
+            }
+            if (mid == 0 || mid == count) {
+                mid = count / 2;
+                std::nth_element(leaves, leaves + mid, leaves + count,
+                                 [&](Proxy a, Proxy b) { return centre(a, axis) < centre(b, axis); });
+            }
+
+            const Proxy node = allocate();
+            const Proxy child1 = build(leaves, mid, node, depth + 1);
+            const Proxy child2 = build(leaves + mid, count - mid, node, depth + 1);
+
+            Node& n = _nodes[node];
+            n.parent = parent;
+            n.child1 = child1;
+            n.child2 = child2;
+            n.box = Box::merge(_nodes[child1].box, _nodes[child2].box);
+            n.height = 1 + std::max(_nodes[child1].height, _nodes[child2].height);
+            return node;
+        }
+
+        void removeLeaf(Proxy leaf) {
+            if (leaf == _root) {
+                _root = none;
+                return;
+            }
+
+            const Proxy parent = _nodes[leaf].parent;
+            const Proxy grandParent = _nodes[parent].parent;
+            const Proxy sibling = _nodes[parent].child1 == leaf ? _nodes[parent].child2 : _nodes[parent].child1;
+
+            if (grandParent != none) {
+                Node& g = _nodes[grandParent];
+                (g.child1 == parent ? g.child1 : g.child2) = sibling;
+                _nodes[sibling].parent = grandParent;
+                release(parent);
+                refit(grandParent);
+            } else {
+                _root = sibling;
+                _nodes[sibling].parent = none;
+                release(parent);
+            }
+        }
+
+        // Walks back to the root, rebalancing and updating heights and boxes.
+        void refit(Proxy index) {
+            while (index != none) {
+                index = balance(index);
+
+                Node& n = _nodes[index];
+                const Node& c1 = _nodes[n.child1];
+                const Node& c2 = _nodes[n.child2];
+                n.height = 1 + std::max(c1.height, c2.height);
+                n.box = Box::merge(c1.box, c2.box);
+                index = n.parent;
+            }
+        }
+
+        /**
+         * @brief rotates the taller child of `a` up when the heights differ by more than one
+         * @return the node now at the position of `a`
+         */
+        Proxy balance(Proxy a) {
+            Node& A = _nodes[a];
+            if (A.leaf() || A.height < 2)
+                return a;
+
+            const Proxy b = A.child1, c = A.child2;
+            const int diff = _nodes[c].height - _nodes[b].height;
+            if (diff > 1)
+                return rotate(a, c, false);
+            if (diff < -1)
+                return rotate(a, b, true);
+            return a;
+        }
+
+        // Moves `up` (a child of `a`) to the place of `a`, `a` adopts the shorter child of `up`.
+        Proxy rotate(Proxy a, Proxy up, bool upIsChild1) {
+            Node& A = _nodes[a];
+            Node& U = _nodes[up];
+            const Proxy f = U.child1, g = U.child2;
+
+            U.child1 = a;
+            U.parent = A.parent;
+            A.parent = up;
+
+            if (U.parent != none) {
+                Node& p = _nodes[U.parent];
+                (p.child1 == a ? p.child1 : p.child2) = up;
+            } else {
+                _root = up;
+            }
+
+            // the taller grandchild stays under `up`, the other one goes to `a`
+            const bool fTaller = _nodes[f].height > _nodes[g].height;
+            const Proxy keep = fTaller ? f : g;
+            const Proxy give = fTaller ? g : f;
+
+            U.child2 = keep;
+            (upIsChild1 ? A.child1 : A.child2) = give;
+            _nodes[give].parent = a;
+
+            const Node& other = _nodes[upIsChild1 ? A.child2 : A.child1];
+            A.box = Box::merge(other.box, _nodes[give].box);
+            A.height = 1 + std::max(other.height, _nodes[give].height);
+            U.box = Box::merge(A.box, _nodes[keep].box);
+            U.height = 1 + std::max(A.height, _nodes[keep].height);
+            return up;
+        }
+
+        bool validate(Proxy i) const {
+            const Node& n = _nodes[i];
+            if (n.leaf())
+                return n.height == 0 && n.child2 == none;
+
+            const Node& c1 = _nodes[n.child1];
+            const Node& c2 = _nodes[n.child2];
+            return c1.parent == i && c2.parent == i
+                && n.height == 1 + std::max(c1.height, c2.height)
+                && n.box.contains(c1.box) && n.box.contains(c2.box)
+                && validate(n.child1) && validate(n.child2);
+        }
+
+        T _margin;
+        std::vector<Node> _nodes;
+        Proxy _root = none;
+        Proxy _free = none;
+        std::size_t _proxies = 0;
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class AabbTree<double>;
+#endif
@@ -7,6 +7,8 @@
 
 #include <cstdint>
 
+#include "Hash.hpp"
+
 #pragma once
 
 // ---------- Color ----------
@@ -15,4 +17,13 @@ struct Color {
     std::uint8_t g{};
     std::uint8_t b{};
     std::uint8_t a{};
+
+    bool operator==(const Color& other) const = default;
+};
+
+template <>
+struct std::hash<Color> {
+    std::size_t operator()(const Color& c) const {
+        return std::size_t(hashing::mix(std::uint64_t(c.r) | std::uint64_t(c.g) << 8 | std::uint64_t(c.b) << 16 | std::uint64_t(c.a) << 24));
+    }
 };
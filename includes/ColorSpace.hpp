@@ -0,0 +1,247 @@
+/**
+ * @file ColorSpace.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief sRGB <-> linear conversion through lookup tables, HSV and HSL conversions for Color
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Color.hpp"
+#include "Math.hpp"
+#include "Vector4.hpp"
+
+// ---------- sRGB transfer ----------
+/**
+ * Color channels are sRGB encoded; blending, filtering and lighting must happen on linear
+ * values. The transfer functions (IEC 61966-2-1) need a pow per channel, so the 8-bit paths go
+ * through tables generated at compile time:
+ * - decode: 256 floats, decode(c) == toLinear(c / 255) rounded to float,
+ * - encode: round(toSrgb(v) * 255) is the number of decision thresholds (the linear values of
+ *   the code midpoints (k - 0.5) / 255) below v. A 4096 entry table indexed by v * 4096 gives
+ *   a lower bound, one threshold comparison finishes it. The result is the correctly rounded
+ *   code, not an approximation.
+ *
+ * Span converters go between Color and linear Vector4<float> (x = r, y = g, z = b, w = a),
+ * alpha is linear and only scaled by 1 / 255, as in pixels::toFloat4.
+ */
+namespace srgb {
+
+    // sRGB encoded [0, 1] -> linear [0, 1], exact.
+    constexpr double toLinear(double c) {
+        return c <= 0.04045 ? c / 12.92 : math::pow((c + 0.055) / 1.055, 2.4);
+    }
+
+    // linear [0, 1] -> sRGB encoded [0, 1], exact.
+    constexpr double toSrgb(double v) {
+        return v <= 0.0031308 ? v * 12.92 : 1.055 * math::pow(v, 1.0 / 2.4) - 0.055;
+    }
+
+    namespace detail {
+
+        constexpr std::size_t encodeBits = 12;
+        constexpr std::size_t encodeSize = std::size_t(1) << encodeBits;
+
+        constexpr std::array<float, 256> makeDecode() {
+            std::array<float, 256> table{};
+            for (std::size_t c = 0; c < 256; ++c)
+                table[c] = float(toLinear(double(c) / 255.0));
+            return table;
+        }
+
+        /*
+         * thresholds[k] = smallest float whose code is k (linear value of the midpoint between
+         * codes k - 1 and k, rounded up), so `v >= thresholds[k]` is exact for float v.
+         * thresholds[0] is unused, thresholds[256] is a sentinel above every clamped input.
+         */
+        constexpr std::array<float, 257> makeThresholds() {
+            std::array<float, 257> table{};
+            for (std::size_t k = 1; k < 256; ++k) {
+                const double t = toLinear((double(k) - 0.5) / 255.0);
+                float f = float(t);
+                if (double(f) < t)
+                    f = std::bit_cast<float>(std::bit_cast<std::uint32_t>(f) + 1u);
+                table[k] = f;
+            }
+            table[256] = 2.0f;
+            return table;
+        }
+
+        inline constexpr std::array<float, 256> decodeTable = makeDecode();
+        inline constexpr std::array<float, 257> thresholds = makeThresholds();
+
+        // encodeTable[i] = code of i / encodeSize
+        constexpr std::array<std::uint8_t, encodeSize> makeEncode() {
+            std::array<std::uint8_t, encodeSize> table{};
+            std::size_t code = 0;
+            for (std::size_t i = 0; i < encodeSize; ++i) {
+                const float v = float(i) / float(encodeSize);
+                while (thresholds[code + 1] <= v)
+                    ++code;
+                table[i] = std::uint8_t(code);
+            }
+            return table;
+        }
+
+        inline constexpr std::array<std::uint8_t, encodeSize> encodeTable = makeEncode();
+
+        // The steepest part of the curve (12.92 * 255 codes per unit) still puts less than one
+        // threshold in a table bucket, so encode() needs a single comparison.
+        constexpr bool oneThresholdPerBucket() {
+            for (std::size_t k = 1; k < 256; ++k) {
+                if (std::size_t(thresholds[k] * float(encodeSize)) == std::size_t(thresholds[k + 1] * float(encodeSize)))
+                    return false;
+            }
+            return true;
+        }
+        static_assert(oneThresholdPerBucket(), "the encode table is too coarse");
+
+    } // namespace detail
+
+    // sRGB code -> linear [0, 1]
+    inline float decode(std::uint8_t c) { return detail::decodeTable[c]; }
+
+    // linear -> nearest sRGB code, clamped to [0, 1], NaN gives 0
+    inline std::uint8_t encode(float v) {
+        v = v > 0.0f ? std::min(v, 1.0f) : 0.0f;
+        const int i = std::min(int(v * float(detail::encodeSize)), int(detail::encodeSize) - 1);
+        const int code = detail::encodeTable[i];
+        return std::uint8_t(code + (v >= detail::thresholds[code + 1]));
+    }
+
+    // out[i] = linear in[i]
+    inline void decode(std::span<const Color> in, std::span<Vector4<float>> out) {
+        const std::size_t n = std::min(in.size(), out.size());
+        for (std::size_t i = 0; i < n; ++i) {
+            const Color c = in[i];
+            out[i].x = decode(c.r);
+            out[i].y = decode(c.g);
+            out[i].z = decode(c.b);
+            out[i].w = float(c.a) * (1.0f / 255.0f);
+        }
+    }
+
+    // out[i] = sRGB in[i], alpha rounded and saturated
+    inline void encode(std::span<const Vector4<float>> in, std::span<Color> out) {
+        const std::size_t n = std::min(in.size(), out.size());
+        for (std::size_t i = 0; i < n; ++i) {
+            const float a = in[i].w * 255.0f + 0.5f;
+            out[i] = {encode(in[i].x), encode(in[i].y), encode(in[i].z),
+                      std::uint8_t(a > 0.0f ? std::min(a, 255.0f) : 0.0f)};
+        }
+    }
+
+} // namespace srgb
+
+// ---------- HSV / HSL ----------
+/**
+ * Hue in degrees [0, 360), saturation, value / lightness and alpha in [0, 1]. The conversions
+ * work on the encoded channels (the usual convention for colour pickers), grey colours get a
+ * hue of 0 and any hue is accepted on the way back. The back conversions use the min/max forms
+ * of the hexcone model (no sector switch), and no function goes through libm, which keeps the
+ * span variants cheap.
+ */
+struct Hsv {
+    float h{}, s{}, v{}, a{};
+};
+
+struct Hsl {
+    float h{}, s{}, l{}, a{};
+};
+
+namespace color_detail {
+
+    // hue in degrees of r, g, b in [0, 1] with the given max and range (max - min)
+    inline float hue(float r, float g, float b, float max, float range) {
+        const float inv = range > 0.0f ? 60.0f / range : 0.0f;
+        const float h = max == r ? (g - b) * inv : max == g ? 120.0f + (b - r) * inv : 240.0f + (r - g) * inv;
+        return h < 0.0f ? h + 360.0f : h;
+    }
+
+    // h mod 360 as a fraction of a turn, times `scale`
+    inline float turns(float h, float scale) {
+        float q = h * (1.0f / 360.0f);
+        q -= float(static_cast<long long>(q));
+        if (q < 0.0f)
+            q += 1.0f;
+        return q * scale;
+    }
+
+    // round and saturate x * 255
+    inline std::uint8_t channel(float x) {
+        const float c = x * 255.0f + 0.5f;
+        return std::uint8_t(c > 0.0f ? std::min(c, 255.0f) : 0.0f);
+    }
+
+} // namespace color_detail
+
+inline Hsv toHsv(Color c) {
+    const float r = float(c.r) * (1.0f / 255.0f), g = float(c.g) * (1.0f / 255.0f), b = float(c.b) * (1.0f / 255.0f);
+    const float max = std::max({r, g, b}), min = std::min({r, g, b});
+    return {color_detail::hue(r, g, b, max, max - min), max > 0.0f ? (max - min) / max : 0.0f, max, float(c.a) * (1.0f / 255.0f)};
+}
+
+inline Color fromHsv(const Hsv& hsv) {
+    const float h = color_detail::turns(hsv.h, 6.0f);
+    const float vs = hsv.v * hsv.s;
+    auto f = [&](float n) {
+        float k = n + h;
+        k = k >= 6.0f ? k - 6.0f : k;
+        return hsv.v - vs * std::clamp(std::min(k, 4.0f - k), 0.0f, 1.0f);
+    };
+    return {color_detail::channel(f(5.0f)), color_detail::channel(f(3.0f)), color_detail::channel(f(1.0f)),
+            color_detail::channel(hsv.a)};
+}
+
+inline Hsl toHsl(Color c) {
+    const float r = float(c.r) * (1.0f / 255.0f), g = float(c.g) * (1.0f / 255.0f), b = float(c.b) * (1.0f / 255.0f);
+    const float max = std::max({r, g, b}), min = std::min({r, g, b});
+    const float l = (max + min) * 0.5f;
+    const float d = std::min(l, 1.0f - l);
+    return {color_detail::hue(r, g, b, max, max - min), d > 0.0f ? (max - l) / d : 0.0f, l, float(c.a) * (1.0f / 255.0f)};
+}
+
+inline Color fromHsl(const Hsl& hsl) {
+    const float h = color_detail::turns(hsl.h, 12.0f);
+    const float a = hsl.s * std::min(hsl.l, 1.0f - hsl.l);
+    auto f = [&](float n) {
+        float k = n + h;
+        k = k >= 12.0f ? k - 12.0f : k;
+        return hsl.l - a * std::clamp(std::min(k - 3.0f, 9.0f - k), -1.0f, 1.0f);
+    };
+    return {color_detail::channel(f(0.0f)), color_detail::channel(f(8.0f)), color_detail::channel(f(4.0f)),
+            color_detail::channel(hsl.a)};
+}
+
+// ---------- Batched ----------
+inline void toHsv(std::span<const Color> in, std::span<Hsv> out) {
+    const std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = toHsv(in[i]);
+}
+
+inline void fromHsv(std::span<const Hsv> in, std::span<Color> out) {
+    const std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = fromHsv(in[i]);
+}
+
+inline void toHsl(std::span<const Color> in, std::span<Hsl> out) {
+    const std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = toHsl(in[i]);
+}
+
+inline void fromHsl(std::span<const Hsl> in, std::span<Color> out) {
+    const std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = fromHsl(in[i]);
+}
@@ -0,0 +1,411 @@
+/**
+ * @file Delaunay.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Bowyer-Watson Delaunay triangulation of Vector2 point sets
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Predicates.hpp"
+#include "Shape.hpp"
+#include "Vector2.hpp"
+
+/**
+ * @brief incremental Bowyer-Watson triangulator
+ *
+ * - triangles are stored by index with their 3 neighbours (no pointers),
+ * - each point is located by walking from the last created triangle,
+ * - points are inserted in BRIO order (random rounds, Hilbert sorted inside a round),
+ *   which keeps the walks short and gives the expected O(n log n) behaviour.
+ *
+ * Orientation and incircle tests use the exact predicates of Predicates.hpp, so degenerate
+ * inputs (grids, cocircular points) cannot corrupt the mesh.
+ * The hull is closed by ghost faces sharing one vertex at infinity instead of a super
+ * triangle, so the output covers exactly the convex hull of the input.
+ * Duplicated points are inserted once and fully collinear inputs give no triangle.
+ * Output triangles are counter-clockwise and index the input span, which does not have to
+ * outlive the triangulation: triangles() reads the points copied at triangulate().
+ *
+ * Every array (mesh, scratch and output) is allocated from the std::pmr::memory_resource
+ * given at construction, a MonotonicArena makes a per-frame triangulation free to release.
+ */
+template <typename T>
+class Delaunay {
+    public:
+        using Real = typename std::conditional<std::is_floating_point<T>::value, T, double>::type;
+        using Index = std::uint32_t;
+        using Face = std::array<Index, 3>;
+
+        static constexpr Index none = std::numeric_limits<Index>::max();
+
+        explicit Delaunay(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : _points(resource), _faces(resource), _free(resource), _indices(resource), _stamp(resource),
+              _cavity(resource), _boundary(resource), _vertexFace(resource) {}
+
+        explicit Delaunay(std::span<const Vector2<T>> points, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : Delaunay(resource) {
+            triangulate(points);
+        }
+
+        std::pmr::memory_resource* resource() const { return _faces.get_allocator().resource(); }
+
+        void triangulate(std::span<const Vector2<T>> points) {
+            _indices.clear();
+            _faces.clear();
+            _free.clear();
+            _points.clear();
+            _stamp.clear();
+            _epoch = 0;
+
+            const std::size_t n = points.size();
+            if (n < 3)
+                return;
+
+            _points.reserve(n);
+            for (const auto& p : points)
+                _points.push_back({Real(p.x), Real(p.y)});
+
+            _ghost = Index(n);
+            _faces.reserve(2 * n + 4);
+            _stamp.reserve(2 * n + 4);
+            _vertexFace.assign(n + 1, none);
+
+            computeBounds();
+            std::pmr::vector<Index> order = insertionOrder();
+            if (!addFirstTriangle(order))
+                return; // every point is on one line
+
+            Index last = 0;
+            for (Index i : order)
+                last = insert(i, last);
+
+            for (const auto& f : _faces)
+                if (f.v[0] != none && !isGhost(f))
+                    _indices.push_back({f.v[0], f.v[1], f.v[2]});
+        }
+
+        // Counter-clockwise index triples into the triangulated span.
+        const std::pmr::vector<Face>& indices() const { return _indices; }
+
+        std::vector<Triangle<T>> triangles() const {
+            std::vector<Triangle<T>> result;
+            result.reserve(_indices.size());
+            for (const auto& f : _indices)
+                result.push_back({vertex(f[0]), vertex(f[1]), vertex(f[2])});
+            return result;
+        }
+
+        // Same triangles, allocated from `resource`.
+        std::pmr::vector<Triangle<T>> triangles(std::pmr::memory_resource* resource) const {
+            std::pmr::vector<Triangle<T>> result(resource);
+            result.reserve(_indices.size());
+            for (const auto& f : _indices)
+                result.push_back({vertex(f[0]), vertex(f[1]), vertex(f[2])});
+            return result;
+        }
+
+    private:
+        // Points are copied at triangulate(), the caller's span is not kept.
+        Vector2<T> vertex(Index i) const { return {T(_points[i].x), T(_points[i].y)}; }
+
+        // v[i] are CCW, n[i] is the neighbour across the edge opposite to v[i].
+        struct Node {
+            Index v[3];
+            Index n[3];
+        };
+
+        struct Edge {
+            Index a, b;     // CCW seen from the cavity
+            Index outside;  // face across the edge
+        };
+
+        // ---------- Setup ----------
+        void computeBounds() {
+            Real minX = _points[0].x, maxX = minX, minY = _points[0].y, maxY = minY;
+            for (const auto& p : _points) {
+                minX = std::min(minX, p.x);
+                maxX = std::max(maxX, p.x);
+                minY = std::min(minY, p.y);
+                maxY = std::max(maxY, p.y);
+            }
+            _min = {minX, minY};
+            _size = std::max(maxX - minX, maxY - minY);
+            if (_size <= Real(0))
+                _size = Real(1);
+        }
+
+        // Shares the common edge of two faces between them.
+        void link(Index f, Index g) {
+            Node& a = _faces[f];
+            Node& b = _faces[g];
+            auto opposite = [](const Node& x, const Node& y) {
+                for (std::size_t i = 0; i < 3; ++i)
+                    if (x.v[i] != y.v[0] && x.v[i] != y.v[1] && x.v[i] != y.v[2])
+                        return i;
+                return std::size_t(0);
+            };
+            a.n[opposite(a, b)] = g;
+            b.n[opposite(b, a)] = f;
+        }
+
+        // Seeds the triangulation with the first non degenerate triangle of `order` and its
+        // 3 ghost faces, the points used are removed from `order`.
+        bool addFirstTriangle(std::pmr::vector<Index>& order) {
+            const Index a = order[0];
+            std::size_t j = 1;
+            while (j < order.size() && _points[order[j]].x == _points[a].x && _points[order[j]].y == _points[a].y)
+                ++j;
+            if (j == order.size())
+                return false;
+
+            std::size_t k = j + 1;
+            while (k < order.size() && orient2d(_points[a], _points[order[j]], _points[order[k]]) == 0.0)
+                ++k;
+            if (k == order.size())
+                return false;
+
+            Index b = order[j], c = order[k];
+            if (orient2d(_points[a], _points[b], _points[c]) < 0.0)
+                std::swap(b, c);
+            order.erase(order.begin() + std::ptrdiff_t(k));
+            order.erase(order.begin() + std::ptrdiff_t(j));
+            order.erase(order.begin());
+
+            const Index inner = newFace(a, b, c);
+            const Index ghosts[3] = {newFace(c, b, _ghost), newFace(a, c, _ghost), newFace(b, a, _ghost)};
+            for (std::size_t i = 0; i < 3; ++i) {
+                link(inner, ghosts[i]);
+                link(ghosts[i], ghosts[(i + 1) % 3]);
+            }
+            _vertexFace[a] = inner;
+            _vertexFace[b] = inner;
+            _vertexFace[c] = inner;
+            return true;
+        }
+
+        // 16 bit Hilbert curve index of a point inside the bounding square.
+        std::uint64_t hilbert(const Vector2<Real>& p) const {
+            constexpr std::uint32_t side = 1u << 16;
+            const Real scale = Real(side - 1) / _size;
+            std::uint32_t x = std::uint32_t((p.x - _min.x) * scale);
+            std::uint32_t y = std::uint32_t((p.y - _min.y) * scale);
+
+            std::uint64_t d = 0;
+            for (std::uint32_t s = side / 2; s > 0; s /= 2) {
+                const std::uint32_t rx = (x & s) ? 1 : 0;
+                const std::uint32_t ry = (y & s) ? 1 : 0;
+                d += std::uint64_t(s) * s * ((3 * rx) ^ ry);
+                if (ry == 0) {
+                    if (rx == 1) {
+                        x = side - 1 - x;
+                        y = side - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+            }
+            return d;
+        }
+
+        // Biased randomized insertion order: shuffled rounds of doubling size, Hilbert sorted.
+        std::pmr::vector<Index> insertionOrder() const {
+            const std::size_t n = _points.size();
+            std::pmr::vector<Index> order(n, resource());
+            std::iota(order.begin(), order.end(), Index(0));
+
+            std::mt19937 rng(0x5eed);
+            std::shuffle(order.begin(), order.end(), rng);
+
+            std::pmr::vector<std::pair<std::uint64_t, Index>> keyed(n, resource());
+            for (std::size_t i = 0; i < n; ++i)
+                keyed[i] = {hilbert(_points[order[i]]), order[i]};
+
+            std::size_t end = n;
+            while (end > 0) {
+                const std::size_t begin = end > 64 ? end / 2 : 0;
+                std::sort(keyed.begin() + begin, keyed.begin() + end);
+                end = begin;
+            }
+            for (std::size_t i = 0; i < n; ++i)
+                order[i] = keyed[i].second;
+            return order;
+        }
+
+        // ---------- Faces ----------
+        Index newFace(Index a, Index b, Index c) {
+            Index f;
+            if (!_free.empty()) {
+                f = _free.back();
+                _free.pop_back();
+            } else {
+                f = Index(_faces.size());
+                _faces.push_back({});
+                _stamp.push_back(0);
+            }
+            _faces[f] = {{a, b, c}, {none, none, none}};
+            return f;
+        }
+
+        // ---------- Ghost faces ----------
+        // A ghost face (a, b, ghost) closes the hull edge b -> a with the point at infinity,
+        // its "circumcircle" is the open half plane left of a -> b.
+        bool isGhost(const Node& f) const { return f.v[0] == _ghost || f.v[1] == _ghost || f.v[2] == _ghost; }
+
+        std::size_t ghostSlot(const Node& f) const { return f.v[0] == _ghost ? 0 : f.v[1] == _ghost ? 1 : 2; }
+
+        // True when p must be removed with the face (strictly inside its circumcircle).
+        bool conflicts(const Node& f, const Vector2<Real>& p) const {
+            if (!isGhost(f))
+                return incircle(_points[f.v[0]], _points[f.v[1]], _points[f.v[2]], p) > 0.0;
+
+            const std::size_t k = ghostSlot(f);
+            const Vector2<Real>& a = _points[f.v[(k + 1) % 3]];
+            const Vector2<Real>& b = _points[f.v[(k + 2) % 3]];
+            const double o = orient2d(a, b, p);
+            if (o != 0.0)
+                return o > 0.0;
+            // on the hull line: only inside the edge itself
+            auto between = [](Real lo, Real v, Real hi) { return (lo < v && v < hi) || (hi < v && v < lo); };
+            return a.x != b.x ? between(a.x, p.x, b.x) : between(a.y, p.y, b.y);
+        }
+
+        // ---------- Insertion ----------
+        // Returns the triangle containing p, or a ghost face whose hull edge p is strictly outside of.
+        Index locate(const Vector2<Real>& p, Index f) {
+            if (isGhost(_faces[f])) {
+                const Node& node = _faces[f];
+                const std::size_t k = ghostSlot(node);
+                if (orient2d(_points[node.v[(k + 1) % 3]], _points[node.v[(k + 2) % 3]], p) > 0.0)
+                    return f;
+                f = node.n[k];
+            }
+
+            // Visibility walk, the starting edge rotates so the walk cannot cycle.
+            for (std::size_t step = 0;; ++step) {
+                const Node& node = _faces[f];
+                Index next = none;
+
+                for (std::size_t k = 0; k < 3; ++k) {
+                    const std::size_t i = (k + step) % 3;
+                    if (orient2d(_points[node.v[(i + 1) % 3]], _points[node.v[(i + 2) % 3]], p) < 0.0) {
+                        next = node.n[i];
+                        break;
+                    }
+                }
+                if (next == none || isGhost(_faces[next]))
+                    return next == none ? f : next;
+                f = next;
+            }
+        }
+
+        Index insert(Index pi, Index start) {
+            const Vector2<Real>& p = _points[pi];
+            const Index t = locate(p, start);
+            const Node& located = _faces[t];
+
+            const bool inside = !isGhost(located);
+
+            if (inside)
+                for (Index v : located.v)
+                    if (_points[v].x == p.x && _points[v].y == p.y)
+                        return t; // duplicate
+
+            // ---------- cavity ----------
+            ++_epoch;
+            _cavity.clear();
+            _cavity.push_back(t);
+            _stamp[t] = _epoch;
+
+            // p exactly on an edge: the neighbour across it must go too.
+            for (std::size_t i = 0; inside && i < 3; ++i) {
+                const Index nb = located.n[i];
+                if (_stamp[nb] != _epoch &&
+                    orient2d(_points[located.v[(i + 1) % 3]], _points[located.v[(i + 2) % 3]], p) == 0.0) {
+                    _stamp[nb] = _epoch;
+                    _cavity.push_back(nb);
+                }
+            }
+
+            for (std::size_t c = 0; c < _cavity.size(); ++c) {
+                const Node& node = _faces[_cavity[c]];
+                for (Index nb : node.n) {
+                    if (_stamp[nb] != _epoch && conflicts(_faces[nb], p)) {
+                        _stamp[nb] = _epoch;
+                        _cavity.push_back(nb);
+                    }
+                }
+            }
+
+            // ---------- boundary ----------
+            _boundary.clear();
+            for (Index f : _cavity) {
+                const Node& node = _faces[f];
+                for (std::size_t i = 0; i < 3; ++i) {
+                    const Index nb = node.n[i];
+                    if (_stamp[nb] != _epoch)
+                        _boundary.push_back({node.v[(i + 1) % 3], node.v[(i + 2) % 3], nb});
+                }
+            }
+
+            for (Index f : _cavity) {
+                _faces[f].v[0] = none;
+                _free.push_back(f);
+            }
+
+            // ---------- re-triangulate the cavity as a fan around p ----------
+            Index last = none;
+            for (const Edge& e : _boundary) {
+                const Index f = newFace(e.a, e.b, pi);
+                _faces[f].n[2] = e.outside;
+                _vertexFace[e.a] = f;
+
+                Node& out = _faces[e.outside];
+                for (std::size_t j = 0; j < 3; ++j)
+                    if (out.v[j] != e.a && out.v[j] != e.b)
+                        out.n[j] = f;
+                last = f;
+            }
+
+            // (a, b, p) shares (b, p) with the face starting at b
+            for (const Edge& e : _boundary) {
+                const Index f = _vertexFace[e.a];
+                const Index g = _vertexFace[e.b];
+                _faces[f].n[0] = g;
+                _faces[g].n[1] = f;
+            }
+            return last;
+        }
+
+        std::pmr::vector<Vector2<Real>> _points;
+        Index _ghost = 0;                      // vertex at infinity closing the hull
+        std::pmr::vector<Node> _faces;
+        std::pmr::vector<Index> _free;
+        std::pmr::vector<Face> _indices;
+
+        // scratch, kept between insertions to avoid allocations
+        std::pmr::vector<std::uint32_t> _stamp;
+        std::pmr::vector<Index> _cavity;
+        std::pmr::vector<Edge> _boundary;
+        std::pmr::vector<Index> _vertexFace;
+        std::uint32_t _epoch = 0;
+
+        Vector2<Real> _min{};
+        Real _size = Real(1);
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class Delaunay<double>;
+#endif
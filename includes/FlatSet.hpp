@@ -0,0 +1,204 @@
+/**
+ * @file FlatSet.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Open addressing hash set for small value keys (vectors, edges, faces, colors)
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "Hash.hpp"
+
+/**
+ * @brief hash set stored in two flat arrays, linear probing
+ *
+ * Each slot has a control byte: 0 when empty, otherwise 0x80 | 7 bits of the hash. Probing
+ * compares control bytes first and only calls Equal when they match, which matters for keys
+ * like Triangle<double> (48 bytes, permutation aware operator==). Capacity is a power of two
+ * indexed with the high bits of the hash, the load factor stays below 3/4, and erase() shifts
+ * the following entries back instead of leaving tombstones, so lookups never slow down over
+ * time.
+ *
+ * Keys must be default constructible and copyable. Inserting invalidates iterators. Both arrays
+ * come from the std::pmr::memory_resource given at construction (a copy uses the default one).
+ */
+template <typename Key, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class FlatSet {
+    public:
+        using value_type = Key;
+        using size_type = std::size_t;
+
+        class const_iterator {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Key;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const Key*;
+                using reference = const Key&;
+
+                const_iterator() = default;
+
+                reference operator*() const { return _set->_slots[_i]; }
+                pointer operator->() const { return &_set->_slots[_i]; }
+
+                const_iterator& operator++() {
+                    ++_i;
+                    skip();
+                    return *this;
+                }
+                const_iterator operator++(int) {
+                    const_iterator old = *this;
+                    ++*this;
+                    return old;
+                }
+
+                bool operator==(const const_iterator& other) const { return _i == other._i; }
+
+            private:
+                friend class FlatSet;
+                const_iterator(const FlatSet* set, std::size_t i) : _set(set), _i(i) { skip(); }
+
+                void skip() {
+                    while (_i < _set->_control.size() && _set->_control[_i] == 0)
+                        ++_i;
+                }
+
+                const FlatSet* _set = nullptr;
+                std::size_t _i = 0;
+        };
+
+        explicit FlatSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : _control(resource), _slots(resource) {}
+
+        explicit FlatSet(std::size_t expected, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : FlatSet(resource) {
+            reserve(expected);
+        }
+
+        std::pmr::memory_resource* resource() const { return _control.get_allocator().resource(); }
+
+        // ---------- Capacity ----------
+        std::size_t size() const { return _size; }
+        bool empty() const { return _size == 0; }
+        std::size_t capacity() const { return _control.size(); }
+
+        // Makes room for `n` keys without rehashing.
+        void reserve(std::size_t n) {
+            std::size_t cap = 8;
+            while (cap * 3 / 4 < n)
+                cap *= 2;
+            if (cap > capacity())
+                rehash(cap);
+        }
+
+        void clear() {
+            std::fill(_control.begin(), _control.end(), std::uint8_t(0));
+            _size = 0;
+        }
+
+        // ---------- Lookup ----------
+        bool contains(const Key& key) const { return find(key, hashOf(key)) != none; }
+
+        // ---------- Modifiers ----------
+        // Returns true when `key` was not in the set.
+        bool insert(const Key& key) {
+            if ((_size + 1) * 4 > capacity() * 3)
+                rehash(capacity() ? capacity() * 2 : 8);
+
+            const std::uint64_t h = hashOf(key);
+            const std::uint8_t tag = tagOf(h);
+            std::size_t i = home(h);
+            for (;; i = (i + 1) & mask()) {
+                if (_control[i] == 0)
+                    break;
+                if (_control[i] == tag && Equal{}(_slots[i], key))
+                    return false;
+            }
+            _control[i] = tag;
+            _slots[i] = key;
+            ++_size;
+            return true;
+        }
+
+        // Returns true when `key` was in the set.
+        bool erase(const Key& key) {
+            std::size_t hole = find(key, hashOf(key));
+            if (hole == none)
+                return false;
+
+            // backward shift: move up every following entry that may fill the hole
+            for (std::size_t i = (hole + 1) & mask(); _control[i] != 0; i = (i + 1) & mask()) {
+                const std::size_t want = home(hashOf(_slots[i]));
+                // i may move to `hole` when its home is not in the cyclic range (hole, i]
+                if (((i - want) & mask()) >= ((i - hole) & mask())) {
+                    _control[hole] = _control[i];
+                    _slots[hole] = std::move(_slots[i]);
+                    hole = i;
+                }
+            }
+            _control[hole] = 0;
+            --_size;
+            return true;
+        }
+
+        // ---------- Iteration ----------
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, _control.size()); }
+
+    private:
+        static constexpr std::size_t none = ~std::size_t(0);
+
+        std::size_t mask() const { return _control.size() - 1; }
+
+        // Re-mixed so that weak hashes (std::hash<int> is the identity) still spread.
+        static std::uint64_t hashOf(const Key& key) { return hashing::mix(std::uint64_t(Hash{}(key))); }
+
+        // The control tag takes the low bits, the slot index the high ones.
+        static std::uint8_t tagOf(std::uint64_t h) { return std::uint8_t(0x80u | (h & 0x7fu)); }
+        std::size_t home(std::uint64_t h) const { return std::size_t(h >> _shift); }
+
+        std::size_t find(const Key& key, std::uint64_t h) const {
+            if (_size == 0)
+                return none;
+            const std::uint8_t tag = tagOf(h);
+            for (std::size_t i = home(h);; i = (i + 1) & mask()) {
+                if (_control[i] == 0)
+                    return none;
+                if (_control[i] == tag && Equal{}(_slots[i], key))
+                    return i;
+            }
+        }
+
+        void rehash(std::size_t cap) {
+            std::pmr::vector<std::uint8_t> control(cap, 0, resource());
+            std::pmr::vector<Key> slots(cap, resource());
+            std::swap(control, _control);
+            std::swap(slots, _slots);
+            _shift = 64 - unsigned(std::countr_zero(cap));
+
+            for (std::size_t j = 0; j < control.size(); ++j) {
+                if (control[j] == 0)
+                    continue;
+                std::size_t i = home(hashOf(slots[j]));
+                while (_control[i] != 0)
+                    i = (i + 1) & mask();
+                _control[i] = control[j];
+                _slots[i] = std::move(slots[j]);
+            }
+        }
+
+        std::pmr::vector<std::uint8_t> _control;
+        std::pmr::vector<Key> _slots;
+        std::size_t _size = 0;
+        unsigned _shift = 64;
+};
@@ -0,0 +1,78 @@
+/**
+ * @file Hash.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Hash mixing helpers shared by the std::hash specializations
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Every std::hash specialization of the library (Vector2/3/4, Line, Triangle, Color) goes
+ * through these helpers, so equal values under operator== always hash the same:
+ * - floating point zero is normalized (0.0 == -0.0),
+ * - Line and Triangle hashes do not depend on the vertex order (their operator== does not),
+ * - the result is run through a 64-bit finalizer, open addressing tables can use the low bits.
+ */
+namespace hashing {
+
+    // splitmix64 finalizer: every input bit flips about half of the output bits.
+    constexpr std::uint64_t mix(std::uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ull;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebull;
+        x ^= x >> 31;
+        return x;
+    }
+
+    // Order dependent: combine(combine(s, a), b) != combine(combine(s, b), a).
+    constexpr std::uint64_t combine(std::uint64_t seed, std::uint64_t value) {
+        return mix(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+    }
+
+    // Bits of a scalar coordinate, -0.0 folded onto 0.0.
+    template <typename T>
+    constexpr std::uint64_t bits(T value) {
+        static_assert(std::is_arithmetic<T>::value, "only arithmetic coordinates are hashable");
+        if constexpr (std::is_floating_point<T>::value) {
+            if (value == T(0))
+                value = T(0);
+            if constexpr (sizeof(T) == sizeof(std::uint64_t))
+                return std::bit_cast<std::uint64_t>(value);
+            else if constexpr (sizeof(T) == sizeof(std::uint32_t))
+                return std::bit_cast<std::uint32_t>(value);
+            else
+                return std::uint64_t(std::hash<long double>{}(value));
+        } else {
+            return std::uint64_t(value);
+        }
+    }
+
+    template <typename T, typename... Rest>
+    constexpr std::uint64_t values(T first, Rest... rest) {
+        std::uint64_t h = mix(bits(first));
+        ((h = combine(h, bits(rest))), ...);
+        return h;
+    }
+
+    // Order independent: the same for any permutation of the arguments.
+    constexpr std::uint64_t unordered(std::uint64_t a, std::uint64_t b) {
+        return a < b ? combine(a, b) : combine(b, a);
+    }
+
+    constexpr std::uint64_t unordered(std::uint64_t a, std::uint64_t b, std::uint64_t c) {
+        if (a > b) std::swap(a, b);
+        if (b > c) std::swap(b, c);
+        if (a > b) std::swap(a, b);
+        return combine(combine(a, b), c);
+    }
+
+} // namespace hashing
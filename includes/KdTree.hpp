@@ -0,0 +1,212 @@
+/**
+ * @file KdTree.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Static implicit kd-tree over Vector3 points: exact, approximate and batched nearest neighbour
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "ThreadPool.hpp"
+#include "Vector3.hpp"
+
+/**
+ * @brief balanced kd-tree stored as one permuted array, no child pointers
+ *
+ * The build partitions [lo, hi) around its median (std::nth_element) along the widest axis
+ * of the range's box; the median stays at mid = lo + (hi - lo) / 2 with its split axis, the
+ * halves [lo, mid) and [mid + 1, hi) are the children. Ranges of at most `leafSize` points
+ * are left unsorted and scanned linearly. Each node is the point, its original index and
+ * the axis, so memory is the point data plus 8 bytes (double) per point.
+ *
+ * Queries walk the tree with a fixed stack and never allocate. With epsilon > 0 a branch is
+ * skipped unless it may hold a point closer than best / (1 + epsilon): the returned distance
+ * is within a factor (1 + epsilon) of the true nearest one.
+ */
+template <typename T>
+class KdTree {
+    static_assert(std::is_floating_point<T>::value, "KdTree needs a floating point coordinate type");
+
+    public:
+        using Index = std::uint32_t;
+
+        static constexpr Index none = std::numeric_limits<Index>::max();
+        static constexpr std::size_t leafSize = 8;
+        static constexpr std::size_t parallelThreshold = 100000;
+
+        struct Neighbor {
+            Index id = none;
+            T distance2 = std::numeric_limits<T>::infinity();   // squared distance to the query
+        };
+
+        KdTree() = default;
+        explicit KdTree(std::span<const Vector3<T>> points, unsigned threads = 0) { build(points, threads); }
+
+        std::size_t size() const { return _nodes.size(); }
+        bool empty() const { return _nodes.empty(); }
+
+        /**
+         * @brief replaces the indexed points, ids are positions in `points`
+         * @param threads 0 = hardware concurrency when points.size() >= parallelThreshold, 1 otherwise
+         */
+        void build(std::span<const Vector3<T>> points, unsigned threads = 0) {
+            const std::size_t n = points.size();
+            _nodes.resize(n);
+            if (n == 0)
+                return;
+
+            Box box{{points[0].x, points[0].y, points[0].z}, {points[0].x, points[0].y, points[0].z}};
+            for (std::size_t i = 0; i < n; ++i) {
+                _nodes[i] = {points[i], Index(i), 0};
+                for (int k = 0; k < 3; ++k) {
+                    box.lo[k] = std::min(box.lo[k], coord(points[i], k));
+                    box.hi[k] = std::max(box.hi[k], coord(points[i], k));
+                }
+            }
+            build(0, n, box, parallel_detail::resolveThreads(threads, n, parallelThreshold));
+        }
+
+        // Closest point to `q`, {none, inf} when the tree is empty.
+        Neighbor nearest(const Vector3<T>& q, T epsilon = T(0)) const {
+            return search(q, epsilon, Neighbor{});
+        }
+
+        /**
+         * @brief out[i] = nearest(queries[i], epsilon)
+         *
+         * The result of the previous query seeds the bound of the next one, which prunes most of
+         * the tree when consecutive queries are close (scan lines, sorted or registered clouds).
+         * @param threads splits the queries in contiguous chunks (about 8 per thread) run on the thread
+         *        pool; an explicit count is used as is since a query is expensive, 0 = same rule as build()
+         */
+        void nearest(std::span<const Vector3<T>> queries, std::span<Neighbor> out, T epsilon = T(0),
+                     unsigned threads = 1) const {
+            const std::size_t n = std::min(queries.size(), out.size());
+            if (threads == 0)
+                threads = parallel_detail::resolveThreads(threads, n, parallelThreshold);
+            parallel_for(0, n, [&](std::size_t begin, std::size_t end) {
+                const Node* previous = nullptr;
+                for (std::size_t i = begin; i < end; ++i) {
+                    Neighbor seed;
+                    if (previous)
+                        seed = {previous->id, (previous->point - queries[i]).square_magnitude()};
+                    out[i] = search(queries[i], epsilon, seed, &previous);
+                }
+            }, threads, std::max<std::size_t>(1, n / (std::size_t(threads) * 8)));
+        }
+
+    private:
+        struct Node {
+            Vector3<T> point;
+            Index id;
+            std::uint8_t axis;
+        };
+
+        struct Box {
+            T lo[3], hi[3];
+        };
+
+        static T coord(const Vector3<T>& p, int axis) { return axis == 0 ? p.x : axis == 1 ? p.y : p.z; }
+
+        void build(std::size_t lo, std::size_t hi, Box box, unsigned threads) {
+            while (hi - lo > leafSize) {
+                int axis = 0;
+                for (int k = 1; k < 3; ++k)
+                    if (box.hi[k] - box.lo[k] > box.hi[axis] - box.lo[axis])
+                        axis = k;
+
+                const std::size_t mid = lo + (hi - lo) / 2;
+                std::nth_element(_nodes.begin() + std::ptrdiff_t(lo), _nodes.begin() + std::ptrdiff_t(mid),
+                                 _nodes.begin() + std::ptrdiff_t(hi), [axis](const Node& a, const Node& b) {
+                                     return coord(a.point, axis) < coord(b.point, axis);
+                                 });
+                _nodes[mid].axis = std::uint8_t(axis);
+
+                // children boxes are the parent one cut at the median, no pass over the points
+                const T split = coord(_nodes[mid].point, axis);
+                Box left = box;
+                left.hi[axis] = split;
+                box.lo[axis] = split;
+
+                if (threads > 1) {
+                    parallel_for(0, 2, [&](std::size_t first, std::size_t last) {
+                        for (std::size_t half = first; half < last; ++half) {
+                            if (half == 0)
+                                build(lo, mid, left, threads / 2);
+                            else
+                                build(mid + 1, hi, box, threads - threads / 2);
+                        }
+                    }, 2, 1);
+                    return;
+                }
+                build(lo, mid, left, 1);
+                lo = mid + 1;
+            }
+        }
+
+        // `best` is an upper bound to start from, `where` receives the node of the result.
+        Neighbor search(const Vector3<T>& q, T epsilon, Neighbor best, const Node** where = nullptr) const {
+            if (_nodes.empty())
+                return best;
+
+            const T scale = (T(1) + epsilon) * (T(1) + epsilon);
+            const Node* nodes = _nodes.data();
+            auto consider = [&](const Node& n) {
+                const T d2 = (n.point - q).square_magnitude();
+                if (d2 < best.distance2 || (d2 == best.distance2 && n.id < best.id)) {
+                    best = {n.id, d2};
+                    if (where)
+                        *where = &n;
+                }
+            };
+
+            struct Range {
+                std::size_t lo, hi;
+                T bound;    // squared distance from q to the splitting plane that separates it
+            };
+            Range stack[64];    // one entry per level, the depth is below log2(n / leafSize) + 1
+            std::size_t top = 0;
+            std::size_t lo = 0, hi = _nodes.size();
+
+            for (;;) {
+                while (hi - lo > leafSize) {
+                    const std::size_t mid = lo + (hi - lo) / 2;
+                    const Node& n = nodes[mid];
+                    const T d = coord(q, n.axis) - coord(n.point, n.axis);
+                    consider(n);
+                    if (d < T(0)) {
+                        stack[top++] = {mid + 1, hi, d * d};
+                        hi = mid;
+                    } else {
+                        stack[top++] = {lo, mid, d * d};
+                        lo = mid + 1;
+                    }
+                }
+                for (std::size_t i = lo; i < hi; ++i)
+                    consider(nodes[i]);
+
+                while (top > 0 && !(stack[top - 1].bound * scale < best.distance2))
+                    --top;
+                if (top == 0)
+                    return best;
+                --top;
+                lo = stack[top].lo;
+                hi = stack[top].hi;
+            }
+        }
+
+        std::vector<Node> _nodes;
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class KdTree<double>;
+#endif
@@ -0,0 +1,270 @@
+/**
+ * @file Lazy.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Opt-in expression templates fusing element-wise Matrix / VectorArray arithmetic
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "Matrix.hpp"
+#include "Simd.hpp"
+#include "VectorArray.hpp"
+
+/**
+ * The eager operators of Matrix and VectorArray are unchanged. Wrapping an operand in lazy()
+ * switches the expression to this layer instead: +, -, unary -, * and / by a scalar build a
+ * small expression object, nothing is computed until the expression is converted to its
+ * container type (or passed to assign()), which then runs one loop over the elements:
+ *
+ *   Matrix4x4 m = lazy(a) + lazy(b) * s - c;    // one pass, no Matrix temporaries
+ *   assign(out, lazy(positions) + lazy(velocities) * dt);   // VectorArray, one SIMD pass per lane
+ *
+ * One side of + and - may be a plain container, the other must already be lazy; * and / take
+ * a lazy operand and a scalar. Each element is computed with the same operations in the same
+ * order as the eager chain, so the results are identical (unless the compiler is allowed to
+ * contract a * b + c into an FMA, which it may do in one form and not the other). Every node
+ * is element-wise, the destination may appear in the expression (assign(m, lazy(m) * 2.0) is
+ * fine). The matrix product is not element-wise and stays eager: lazy(a * b) + c evaluates
+ * a * b first. The operands of + and - must have the same size (asserted in debug builds).
+ *
+ * Expressions hold references to lvalue operands and copies of rvalue ones; keep them as
+ * temporaries (or make sure the operands outlive them) as with any view.
+ */
+
+// ---------- Containers ----------
+template <typename C>
+struct LazyContainer {};
+
+// Matrix: one lane, the ROWS * COLS elements in row-major order. The lane pointer is taken
+// from the whole array: walking past data[0] from &data[0][0] is out of bounds for the compiler.
+template <typename T, std::size_t ROWS, std::size_t COLS, typename E>
+struct LazyContainer<Matrix<T, ROWS, COLS, E>> {
+    using value_type = T;
+    using container_type = Matrix<T, ROWS, COLS, E>;
+    static constexpr std::size_t lanes = 1;
+
+    static std::size_t size(const container_type&) { return ROWS * COLS; }
+    static const T* lane(const container_type& m, std::size_t) { return reinterpret_cast<const T*>(&m.data); }
+    static T* lane(container_type& m, std::size_t) { return reinterpret_cast<T*>(&m.data); }
+    static void resize(container_type&, std::size_t) {}
+};
+
+// VectorArray: one lane per component.
+template <typename V>
+struct LazyContainer<VectorArray<V>> {
+    using value_type = typename VectorArray<V>::value_type;
+    using container_type = VectorArray<V>;
+    static constexpr std::size_t lanes = VectorArray<V>::components;
+
+    static std::size_t size(const container_type& a) { return a.size(); }
+    static const value_type* lane(const container_type& a, std::size_t k) { return a.lane(k); }
+    static value_type* lane(container_type& a, std::size_t k) { return a.lane(k); }
+    static void resize(container_type& a, std::size_t n) { a.resize(n); }
+};
+
+template <typename C, typename = void>
+struct is_lazy_container : std::false_type {};
+
+template <typename C>
+struct is_lazy_container<C, std::void_t<typename LazyContainer<C>::container_type>> : std::true_type {};
+
+// ---------- Expression nodes ----------
+// CRTP base, only used to recognise expressions and to evaluate them.
+template <typename E>
+struct LazyExpression;
+
+template <typename E>
+struct is_lazy_expression : std::is_base_of<LazyExpression<E>, E> {};
+
+template <typename C, typename E>
+void assign(C& dst, const LazyExpression<E>& expr);
+
+template <typename E>
+struct LazyExpression {
+    const E& self() const { return static_cast<const E&>(*this); }
+
+    // E is incomplete here, its members are only named through the deferred `Self`
+    template <typename Self = E, typename C = typename Self::container_type>
+    C eval() const {
+        C result{};
+        assign(result, *this);
+        return result;
+    }
+
+    template <typename C, typename Self = E, typename = typename std::enable_if<std::is_same<C, typename Self::container_type>::value>::type>
+    operator C() const { return eval(); }
+};
+
+// Leaf: `Ref` is `const C&` for lvalues and `C` for rvalues.
+template <typename Ref>
+struct LazyTerminal : LazyExpression<LazyTerminal<Ref>> {
+    using container_type = std::remove_cv_t<std::remove_reference_t<Ref>>;
+    using traits = LazyContainer<container_type>;
+    using value_type = typename traits::value_type;
+    static constexpr bool isScalar = false;
+
+    Ref c;
+
+    explicit LazyTerminal(Ref c) : c(std::forward<Ref>(c)) {}
+
+    std::size_t size() const { return traits::size(c); }
+
+    template <typename P>
+    P load(std::size_t k, std::size_t i) const { return P::load(traits::lane(c, k) + i); }
+};
+
+// Broadcast scalar operand of * and /.
+template <typename T, typename C>
+struct LazyScalar : LazyExpression<LazyScalar<T, C>> {
+    using container_type = C;
+    using value_type = T;
+    static constexpr bool isScalar = true;
+
+    T value;
+
+    explicit LazyScalar(T value) : value(value) {}
+
+    template <typename P>
+    P load(std::size_t, std::size_t) const { return P::broadcast(value); }
+};
+
+template <typename Op, typename L, typename R>
+struct LazyBinary : LazyExpression<LazyBinary<Op, L, R>> {
+    static_assert(std::is_same<typename L::container_type, typename R::container_type>::value,
+                  "lazy operands must have the same container type");
+    using container_type = typename L::container_type;
+    using value_type = typename L::value_type;
+    static constexpr bool isScalar = false;
+
+    L l;
+    R r;
+
+    LazyBinary(L l, R r) : l(std::move(l)), r(std::move(r)) {
+        if constexpr (!L::isScalar && !R::isScalar)
+            assert(this->l.size() == this->r.size() && "lazy operands must have the same size");
+    }
+
+    std::size_t size() const {
+        if constexpr (L::isScalar)
+            return r.size();
+        else
+            return l.size();
+    }
+
+    template <typename P>
+    P load(std::size_t k, std::size_t i) const { return Op::apply(l.template load<P>(k, i), r.template load<P>(k, i)); }
+};
+
+template <typename E>
+struct LazyNegate : LazyExpression<LazyNegate<E>> {
+    using container_type = typename E::container_type;
+    using value_type = typename E::value_type;
+    static constexpr bool isScalar = false;
+
+    E e;
+
+    explicit LazyNegate(E e) : e(std::move(e)) {}
+
+    std::size_t size() const { return e.size(); }
+
+    // x * -1 is exactly -x, signed zeros included
+    template <typename P>
+    P load(std::size_t k, std::size_t i) const { return e.template load<P>(k, i) * P::broadcast(value_type(-1)); }
+};
+
+namespace lazy_detail {
+
+    struct Add { template <typename P> static P apply(P a, P b) { return a + b; } };
+    struct Sub { template <typename P> static P apply(P a, P b) { return a - b; } };
+    struct Mul { template <typename P> static P apply(P a, P b) { return a * b; } };
+    struct Div { template <typename P> static P apply(P a, P b) { return a / b; } };
+
+    template <typename X>
+    using bare = std::remove_cv_t<std::remove_reference_t<X>>;
+
+    // An expression operand as is, a container wrapped in a terminal.
+    template <typename X>
+    auto operand(X&& x) {
+        if constexpr (is_lazy_expression<bare<X>>::value)
+            return bare<X>(std::forward<X>(x));
+        else
+            return LazyTerminal<std::conditional_t<std::is_lvalue_reference<X>::value, const bare<X>&, bare<X>>>(std::forward<X>(x));
+    }
+
+    template <typename X>
+    constexpr bool isOperand = is_lazy_expression<bare<X>>::value || is_lazy_container<bare<X>>::value;
+
+    // at least one lazy side, the other lazy or a container
+    template <typename A, typename B>
+    constexpr bool isBinary = isOperand<A> && isOperand<B> &&
+                              (is_lazy_expression<bare<A>>::value || is_lazy_expression<bare<B>>::value);
+
+    template <typename Op, typename A, typename B>
+    auto binary(A&& a, B&& b) {
+        auto l = operand(std::forward<A>(a));
+        auto r = operand(std::forward<B>(b));
+        return LazyBinary<Op, decltype(l), decltype(r)>(std::move(l), std::move(r));
+    }
+
+    template <typename Op, typename E, typename S>
+    auto scalarRight(E&& e, S s) {
+        using X = bare<E>;
+        using Scalar = LazyScalar<typename X::value_type, typename X::container_type>;
+        return LazyBinary<Op, X, Scalar>(std::forward<E>(e), Scalar(typename X::value_type(s)));
+    }
+
+} // namespace lazy_detail
+
+// ---------- Entry point ----------
+// Starts a lazy expression on a Matrix or VectorArray (an expression is returned as is).
+template <typename X, typename = typename std::enable_if<lazy_detail::isOperand<X>>::type>
+auto lazy(X&& x) { return lazy_detail::operand(std::forward<X>(x)); }
+
+// ---------- Operators ----------
+template <typename A, typename B, typename = typename std::enable_if<lazy_detail::isBinary<A, B>>::type>
+auto operator+(A&& a, B&& b) { return lazy_detail::binary<lazy_detail::Add>(std::forward<A>(a), std::forward<B>(b)); }
+
+template <typename A, typename B, typename = typename std::enable_if<lazy_detail::isBinary<A, B>>::type>
+auto operator-(A&& a, B&& b) { return lazy_detail::binary<lazy_detail::Sub>(std::forward<A>(a), std::forward<B>(b)); }
+
+template <typename E, typename = typename std::enable_if<is_lazy_expression<lazy_detail::bare<E>>::value>::type>
+auto operator-(E&& e) { return LazyNegate<lazy_detail::bare<E>>(std::forward<E>(e)); }
+
+template <typename E, typename S,
+          typename = typename std::enable_if<is_lazy_expression<lazy_detail::bare<E>>::value && std::is_arithmetic<S>::value>::type>
+auto operator*(E&& e, S s) { return lazy_detail::scalarRight<lazy_detail::Mul>(std::forward<E>(e), s); }
+
+// s * e is computed as e * s (exact, multiplication commutes).
+template <typename S, typename E,
+          typename = typename std::enable_if<is_lazy_expression<lazy_detail::bare<E>>::value && std::is_arithmetic<S>::value>::type>
+auto operator*(S s, E&& e) { return lazy_detail::scalarRight<lazy_detail::Mul>(std::forward<E>(e), s); }
+
+template <typename E, typename S,
+          typename = typename std::enable_if<is_lazy_expression<lazy_detail::bare<E>>::value && std::is_arithmetic<S>::value>::type>
+auto operator/(E&& e, S s) { return lazy_detail::scalarRight<lazy_detail::Div>(std::forward<E>(e), s); }
+
+// ---------- Evaluation ----------
+// dst = expr in one pass per lane, resizing dst (VectorArray) to the expression size.
+template <typename C, typename E>
+void assign(C& dst, const LazyExpression<E>& expr) {
+    static_assert(std::is_same<C, typename E::container_type>::value, "assign: destination and expression types differ");
+    using traits = LazyContainer<C>;
+    using T = typename traits::value_type;
+    const E& e = expr.self();
+    const std::size_t n = e.size();
+
+    traits::resize(dst, n);
+    for (std::size_t k = 0; k < traits::lanes; ++k) {
+        T* out = traits::lane(dst, k);
+        simd::for_each<T>(n, [&](auto p, std::size_t i) {
+            using P = decltype(p);
+            e.template load<P>(k, i).store(out + i);
+        });
+    }
+}
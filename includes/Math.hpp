@@ -0,0 +1,226 @@
+/**
+ * @file Math.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief constexpr versions of the <cmath> functions the library needs at compile time
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * <cmath> is not constexpr in C++20. These functions compute in double with series and exact
+ * range reduction when constant evaluated (table generation, constexpr constructors), and
+ * forward to <cmath> at run time, so they cost nothing in normal code. Compile time results
+ * are within an ulp or two of <cmath> (sqrt is correctly rounded, sin / cos are meant
+ * for angles of a few turns, not 1e10 radians).
+ * Domain errors are not reported: log/pow/sqrt of a negative value return NaN.
+ */
+namespace math {
+
+    constexpr double ln2 = 0.693147180559945309417232121458176568;
+    constexpr double pi = 3.141592653589793238462643383279502884;
+
+    template <typename T>
+    constexpr T abs(T x) { return x < T(0) ? -x : x; }
+
+    namespace detail {
+
+        // x - c * c with the product kept exact (Dekker), for c close to sqrt(x)
+        constexpr double residual(double x, double c) {
+            constexpr double split = 134217729.0; // 2^27 + 1
+            const double t = split * c;
+            const double hi = t - (t - c), lo = c - hi;
+            const double p = c * c;
+            const double error = ((hi * hi - p) + 2.0 * hi * lo) + lo * lo;
+            return (x - p) - error;
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    constexpr T sqrt(T value) {
+        static_assert(std::is_floating_point<T>::value, "math::sqrt needs a floating point type");
+        if (!std::is_constant_evaluated())
+            return std::sqrt(value);
+
+        double x = double(value);
+        if (!(x > 0.0))
+            return x == 0.0 ? value : std::numeric_limits<T>::quiet_NaN();
+        if (x == std::numeric_limits<double>::infinity())
+            return value;
+
+        // x = m * 4^e with m in [1, 4), the scaling is exact
+        double scale = 1.0;
+        while (x >= 4.0) {
+            x *= 0.25;
+            scale *= 2.0;
+        }
+        while (x < 1.0) {
+            x *= 4.0;
+            scale *= 0.5;
+        }
+
+        // Newton from above ((m + 1) / 2 >= sqrt(m)), stops once it no longer decreases
+        double y = (x + 1.0) * 0.5;
+        for (int i = 0; i < 64; ++i) {
+            const double next = (y + x / y) * 0.5;
+            if (next >= y)
+                break;
+            y = next;
+        }
+
+        // Newton may stop an ulp away, keep the neighbour with the smallest exact residual
+        double best = y;
+        double error = abs(detail::residual(x, y));
+        for (double c : {std::bit_cast<double>(std::bit_cast<std::uint64_t>(y) - 1u),
+                         std::bit_cast<double>(std::bit_cast<std::uint64_t>(y) + 1u)}) {
+            const double e = abs(detail::residual(x, c));
+            if (e < error) {
+                best = c;
+                error = e;
+            }
+        }
+        return T(best * scale);
+    }
+
+    namespace detail {
+
+        // pi / 2 in three parts (fdlibm), k * part is exact for |k| < 2^20
+        constexpr double pio2Hi = 1.57079632673412561417e+00;
+        constexpr double pio2Mid = 6.07710050630396597660e-11;
+        constexpr double pio2Lo = 2.02226624879595063154e-21;
+
+        // sin(r) and cos(r) for |r| <= pi / 4
+        constexpr double sinSeries(double r) {
+            const double r2 = r * r;
+            double term = r, sum = r;
+            for (int n = 1; n < 14; ++n) {
+                term *= -r2 / double((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double cosSeries(double r) {
+            const double r2 = r * r;
+            double term = 1.0, sum = 1.0;
+            for (int n = 1; n < 14; ++n) {
+                term *= -r2 / double((2 * n - 1) * (2 * n));
+                sum += term;
+            }
+            return sum;
+        }
+
+        // x = k pi / 2 + r, returns r and the quadrant k mod 4
+        constexpr double reduce(double x, int& quadrant) {
+            const double k = double(static_cast<long long>(x * (2.0 / pi) + (x < 0.0 ? -0.5 : 0.5)));
+            quadrant = int(static_cast<long long>(k) & 3);
+            return ((x - k * pio2Hi) - k * pio2Mid) - k * pio2Lo;
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    constexpr T sin(T value) {
+        static_assert(std::is_floating_point<T>::value, "math::sin needs a floating point type");
+        if (!std::is_constant_evaluated())
+            return std::sin(value);
+        int quadrant = 0;
+        const double r = detail::reduce(double(value), quadrant);
+        switch (quadrant) {
+            case 0: return T(detail::sinSeries(r));
+            case 1: return T(detail::cosSeries(r));
+            case 2: return T(-detail::sinSeries(r));
+            default: return T(-detail::cosSeries(r));
+        }
+    }
+
+    template <typename T>
+    constexpr T cos(T value) {
+        static_assert(std::is_floating_point<T>::value, "math::cos needs a floating point type");
+        if (!std::is_constant_evaluated())
+            return std::cos(value);
+        int quadrant = 0;
+        const double r = detail::reduce(double(value), quadrant);
+        switch (quadrant) {
+            case 0: return T(detail::cosSeries(r));
+            case 1: return T(-detail::sinSeries(r));
+            case 2: return T(-detail::cosSeries(r));
+            default: return T(detail::sinSeries(r));
+        }
+    }
+
+    // natural logarithm, x > 0
+    constexpr double log(double x) {
+        if (!std::is_constant_evaluated())
+            return std::log(x);
+        if (!(x > 0.0))
+            return x == 0.0 ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+        if (x == std::numeric_limits<double>::infinity())
+            return x;
+
+        // x = m * 2^e, m in [sqrt(1/2), sqrt(2)): the scaling by 2 is exact
+        int e = 0;
+        while (x >= 1.4142135623730951) {
+            x *= 0.5;
+            ++e;
+        }
+        while (x < 0.7071067811865476) {
+            x *= 2.0;
+            --e;
+        }
+
+        // log(m) = 2 atanh(s), s = (m - 1) / (m + 1), |s| < 0.172
+        const double s = (x - 1.0) / (x + 1.0);
+        const double s2 = s * s;
+        double term = s, sum = 0.0;
+        for (int k = 1; term != 0.0 && k < 64; k += 2) {
+            sum += term / double(k);
+            term *= s2;
+        }
+        return double(e) * ln2 + 2.0 * sum;
+    }
+
+    constexpr double exp(double x) {
+        if (!std::is_constant_evaluated())
+            return std::exp(x);
+        if (x != x)
+            return x;
+        if (x > 709.8)
+            return std::numeric_limits<double>::infinity();
+        if (x < -745.2)
+            return 0.0;
+
+        // x = k ln2 + r, |r| <= ln2 / 2
+        const int k = int(x / ln2 + (x < 0.0 ? -0.5 : 0.5));
+        const double r = x - double(k) * ln2;
+        double term = 1.0, sum = 1.0;
+        for (int n = 1; n < 32; ++n) {
+            term *= r / double(n);
+            sum += term;
+        }
+        for (int i = 0; i < k; ++i)
+            sum *= 2.0;
+        for (int i = 0; i > k; --i)
+            sum *= 0.5;
+        return sum;
+    }
+
+    // x^y for x >= 0
+    constexpr double pow(double x, double y) {
+        if (!std::is_constant_evaluated())
+            return std::pow(x, y);
+        if (y == 0.0)
+            return 1.0;
+        if (x == 0.0)
+            return y > 0.0 ? 0.0 : std::numeric_limits<double>::infinity();
+        return exp(y * log(x));
+    }
+
+} // namespace math
@@ -10,9 +10,52 @@
 #include <cmath>
 
 #include <type_traits>
+#include <utility>
 #include <cstddef>
+#include <cstdint>
 #include <cmath>
 
+#include "Simd.hpp"
+#include "Vector4.hpp"
+
+// ---------- Kernels ----------
+// Reference loops, every specialised kernel must give bit-identical results. They are also the
+// constexpr path: Matrix switches to them when constant evaluated (intrinsics are not constexpr).
+template <typename T, std::size_t ROWS, std::size_t COLS>
+struct MatrixReference {
+    template <std::size_t OTHER_COLS>
+    static constexpr void multiply(const T (&a)[ROWS][COLS], const T (&b)[COLS][OTHER_COLS], T (&out)[ROWS][OTHER_COLS]) {
+        for (std::size_t i = 0; i < ROWS; ++i)
+            for (std::size_t j = 0; j < OTHER_COLS; ++j) {
+                out[i][j] = T(0);
+                for (std::size_t k = 0; k < COLS; ++k)
+                    out[i][j] += a[i][k] * b[k][j];
+            }
+    }
+
+    static constexpr void transpose(const T (&a)[ROWS][COLS], T (&out)[COLS][ROWS]) {
+        for (std::size_t i = 0; i < ROWS; ++i)
+            for (std::size_t j = 0; j < COLS; ++j)
+                out[j][i] = a[i][j];
+    }
+
+    // out = a * v, v being a column vector
+    static constexpr void apply(const T (&a)[ROWS][COLS], const T (&v)[COLS], T (&out)[ROWS]) {
+        for (std::size_t i = 0; i < ROWS; ++i) {
+            out[i] = T(0);
+            for (std::size_t k = 0; k < COLS; ++k)
+                out[i] += a[i][k] * v[k];
+        }
+    }
+};
+
+// Kernels used by Matrix, specialised for 4x4 float/double when SIMD is available.
+template <typename T, std::size_t ROWS, std::size_t COLS>
+struct MatrixKernel : MatrixReference<T, ROWS, COLS> {};
+
+template <typename T, std::size_t N>
+struct MatrixLU;
+
 template <
     typename T, std::size_t ROWS, std::size_t COLS,
     typename = typename std::enable_if<ROWS >=  1 && COLS >=  1>::type
@@ -21,8 +64,7 @@ struct Matrix {
     T data[ROWS][COLS]{};
 
     // Statics
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    static Matrix identity() {
+    static constexpr Matrix identity() requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         Matrix mat{};
         for (std::size_t i = 0; i < ROWS; ++i) {
                 mat.data[i][i] = T(1);
@@ -30,12 +72,11 @@ struct Matrix {
         return mat;
     }
 
-    static Matrix zero() {
+    static constexpr Matrix zero() {
         return Matrix{};
     }
 
-    template<typename = typename std::enable_if<ROWS == COLS>::type>
-    static Matrix diagonal(const T (&values)[ROWS]) {
+    static constexpr Matrix diagonal(const T (&values)[ROWS]) requires (ROWS == COLS) {
         Matrix mat{};
         for (std::size_t i = 0; i < ROWS; ++i)
             mat.data[i][i] = values[i];
@@ -43,12 +84,11 @@ struct Matrix {
     }
 
     // Access operator
-    T& operator()(std::size_t i, std::size_t j) { return data[i][j]; }
-    const T& operator()(std::size_t i, std::size_t j) const { return data[i][j]; }
+    constexpr T& operator()(std::size_t i, std::size_t j) { return data[i][j]; }
+    constexpr const T& operator()(std::size_t i, std::size_t j) const { return data[i][j]; }
 
     // Unary operators
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix operator-() const {
+    constexpr Matrix operator-() const requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         Matrix result{};
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
@@ -57,8 +97,7 @@ struct Matrix {
     }
 
     // Arythmetic operator
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix operator+(const Matrix& other) const {
+    constexpr Matrix operator+(const Matrix& other) const requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         Matrix result{};
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
@@ -66,8 +105,7 @@ struct Matrix {
         return result;
     }
 
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-     Matrix operator-(const Matrix& other) const {
+     constexpr Matrix operator-(const Matrix& other) const requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         Matrix result{};
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
@@ -76,27 +114,36 @@ struct Matrix {
     }
     
     //
-    template <std::size_t OTHER_COLS, typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix<T, ROWS, OTHER_COLS> operator*(const Matrix<T, COLS, OTHER_COLS>& other) const {
+    template <std::size_t OTHER_COLS>
+    constexpr Matrix<T, ROWS, OTHER_COLS> operator*(const Matrix<T, COLS, OTHER_COLS>& other) const requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         Matrix<T, ROWS, OTHER_COLS> result{};
-        for (std::size_t i = 0; i < ROWS; ++i)
-            for (std::size_t j = 0; j < OTHER_COLS; ++j)
-                for (std::size_t k = 0; k < COLS; ++k)
-                    result.data[i][j] += data[i][k] * other.data[k][j];
+        if (std::is_constant_evaluated())
+            MatrixReference<T, ROWS, COLS>::multiply(data, other.data, result.data);
+        else
+            MatrixKernel<T, ROWS, COLS>::multiply(data, other.data, result.data);
         return result;
     }
 
+    // Matrix-vector product, the vector is the column (x, y, z, w).
+    constexpr Vector4<T> operator*(const Vector4<T>& v) const requires (std::is_arithmetic<T>::value && ROWS == 4 && COLS == 4) {
+        const T in[COLS] = {v.x, v.y, v.z, v.w};
+        T out[ROWS]{};
+        if (std::is_constant_evaluated())
+            MatrixReference<T, ROWS, COLS>::apply(data, in, out);
+        else
+            MatrixKernel<T, ROWS, COLS>::apply(data, in, out);
+        return {out[3], out[0], out[1], out[2]};
+    }
+
 
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix& operator+=(const Matrix& other) {
+    constexpr Matrix& operator+=(const Matrix& other) requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
                 data[i][j] += other.data[i][j];
         return *this;
     }
 
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix operator/(T scalar) const {
+    constexpr Matrix operator/(T scalar) const requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         Matrix result{};
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
@@ -104,32 +151,28 @@ struct Matrix {
         return result;
     }
 
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix& operator*=(T scalar) {
+    constexpr Matrix& operator*=(T scalar) requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
                 data[i][j] *= scalar;
         return *this;
     }
 
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix& operator/=(T scalar) {
+    constexpr Matrix& operator/=(T scalar) requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
                 data[i][j] /= scalar;
         return *this;
     }
 
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix& operator-=(const Matrix& other) {
+    constexpr Matrix& operator-=(const Matrix& other) requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
                 data[i][j] -= other.data[i][j];
         return *this;
     }
 
-    template <typename = typename std::enable_if<std::is_arithmetic<T>::value && ROWS == COLS>::type>
-    Matrix operator*(T scalar) const {
+    constexpr Matrix operator*(T scalar) const requires (std::is_arithmetic<T>::value && ROWS == COLS) {
         Matrix result{};
         for (std::size_t i = 0; i < ROWS; ++i)
             for (std::size_t j = 0; j < COLS; ++j)
@@ -137,16 +180,428 @@ struct Matrix {
         return result;
     }
 
-    Matrix transpose() const {
-        Matrix result{};
-        for (std::size_t i = 0; i < ROWS; ++i)
-            for (std::size_t j = 0; j < COLS; ++j)
-                result.data[j][i] = data[i][j];
+    constexpr Matrix<T, COLS, ROWS> transpose() const {
+        Matrix<T, COLS, ROWS> result{};
+        if (std::is_constant_evaluated())
+            MatrixReference<T, ROWS, COLS>::transpose(data, result.data);
+        else
+            MatrixKernel<T, ROWS, COLS>::transpose(data, result.data);
         return result;
     }
 
+    // ---------- Linear algebra ----------
+    // Closed form up to 4x4, partial-pivot LU above (Bareiss elimination in 64 bit for integers).
+    constexpr T determinant() const requires (std::is_arithmetic<T>::value && ROWS == COLS) {
+        const auto& a = data;
+
+        if constexpr (ROWS == 1) {
+            return a[0][0];
+        } else if constexpr (ROWS == 2) {
+            return a[0][0] * a[1][1] - a[0][1] * a[1][0];
+        } else if constexpr (ROWS == 3) {
+            return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1])
+                 - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+                 + a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+        } else if constexpr (ROWS == 4) {
+            const T s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+            const T s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+            const T s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+            const T s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+            const T s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+            const T s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+
+            const T c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+            const T c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+            const T c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+            const T c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+            const T c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+            const T c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        } else if constexpr (std::is_floating_point<T>::value) {
+            return lu().determinant();
+        } else {
+            // fraction free: every division is exact, exact while the minors fit in 64 bits
+            std::int64_t m[ROWS][COLS];
+            for (std::size_t i = 0; i < ROWS; ++i)
+                for (std::size_t j = 0; j < COLS; ++j)
+                    m[i][j] = std::int64_t(a[i][j]);
+
+            std::int64_t sign = 1, previous = 1;
+            for (std::size_t k = 0; k + 1 < ROWS; ++k) {
+                if (m[k][k] == 0) {
+                    std::size_t p = k + 1;
+                    while (p < ROWS && m[p][k] == 0)
+                        ++p;
+                    if (p == ROWS)
+                        return T(0);
+                    for (std::size_t j = 0; j < COLS; ++j)
+                        std::swap(m[k][j], m[p][j]);
+                    sign = -sign;
+                }
+                for (std::size_t i = k + 1; i < ROWS; ++i)
+                    for (std::size_t j = k + 1; j < COLS; ++j)
+                        m[i][j] = (m[i][j] * m[k][k] - m[i][k] * m[k][j]) / previous;
+                previous = m[k][k];
+            }
+            return T(sign * m[ROWS - 1][COLS - 1]);
+        }
+    }
+
+    /**
+     * @brief inverse of the matrix, closed form up to 4x4 and LU above
+     *
+     * A singular matrix has no inverse: the zero matrix is returned (check determinant() first
+     * when the input may be degenerate).
+     */
+    constexpr Matrix inverse() const requires (std::is_floating_point<T>::value && ROWS == COLS) {
+        const auto& a = data;
+        Matrix r{};
+
+        if constexpr (ROWS == 1) {
+            if (a[0][0] == T(0)) return r;
+            r.data[0][0] = T(1) / a[0][0];
+        } else if constexpr (ROWS == 2) {
+            const T det = determinant();
+            if (det == T(0)) return r;
+            const T inv = T(1) / det;
+            r.data[0][0] =  a[1][1] * inv;
+            r.data[0][1] = -a[0][1] * inv;
+            r.data[1][0] = -a[1][0] * inv;
+            r.data[1][1] =  a[0][0] * inv;
+        } else if constexpr (ROWS == 3) {
+            const T c00 = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+            const T c10 = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+            const T c20 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+            const T det = a[0][0] * c00 + a[0][1] * c10 + a[0][2] * c20;
+            if (det == T(0)) return r;
+            const T inv = T(1) / det;
+
+            r.data[0][0] = c00 * inv;
+            r.data[0][1] = (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * inv;
+            r.data[0][2] = (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * inv;
+            r.data[1][0] = c10 * inv;
+            r.data[1][1] = (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * inv;
+            r.data[1][2] = (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * inv;
+            r.data[2][0] = c20 * inv;
+            r.data[2][1] = (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * inv;
+            r.data[2][2] = (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * inv;
+        } else if constexpr (ROWS == 4) {
+            const T s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+            const T s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+            const T s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+            const T s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+            const T s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+            const T s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+
+            const T c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+            const T c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+            const T c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+            const T c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+            const T c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+            const T c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+
+            const T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            if (det == T(0)) return r;
+            const T inv = T(1) / det;
+
+            r.data[0][0] = ( a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * inv;
+            r.data[0][1] = (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * inv;
+            r.data[0][2] = ( a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * inv;
+            r.data[0][3] = (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * inv;
+
+            r.data[1][0] = (-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * inv;
+            r.data[1][1] = ( a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * inv;
+            r.data[1][2] = (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * inv;
+            r.data[1][3] = ( a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * inv;
+
+            r.data[2][0] = ( a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * inv;
+            r.data[2][1] = (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * inv;
+            r.data[2][2] = ( a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * inv;
+            r.data[2][3] = (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * inv;
+
+            r.data[3][0] = (-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * inv;
+            r.data[3][1] = ( a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * inv;
+            r.data[3][2] = (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * inv;
+            r.data[3][3] = ( a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * inv;
+        } else {
+            r = lu().inverse();
+        }
+        return r;
+    }
+
+    /**
+     * @brief inverse of an affine 4x4 transform (last row 0 0 0 1)
+     *
+     * Only the upper 3x3 block is inverted: [R t]^-1 = [R^-1  -R^-1 t]. A singular block gives
+     * the zero matrix, like inverse().
+     */
+    constexpr Matrix inverseAffine() const requires (std::is_floating_point<T>::value && ROWS == 4 && COLS == 4) {
+        Matrix<T, 3, 3> linear{};
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                linear.data[i][j] = data[i][j];
+        if (linear.determinant() == T(0))
+            return Matrix{};
+        linear = linear.inverse();
+
+        Matrix r{};
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j)
+                r.data[i][j] = linear.data[i][j];
+            r.data[i][3] = -(linear.data[i][0] * data[0][3] + linear.data[i][1] * data[1][3] + linear.data[i][2] * data[2][3]);
+        }
+        r.data[3][3] = T(1);
+        return r;
+    }
+
+    // LU decomposition with partial pivoting, PA = LU.
+    constexpr MatrixLU<T, ROWS> lu() const requires (std::is_floating_point<T>::value && ROWS == COLS) {
+        return MatrixLU<T, ROWS>(*this);
+    }
+
 };
 
+// ---------- LU ----------
+/**
+ * @brief partial-pivot LU decomposition of a square Matrix
+ *
+ * `lu` stores L (unit diagonal, below) and U (diagonal and above), row `i` of the
+ * factorisation comes from row `pivot[i]` of the input.
+ */
+template <typename T, std::size_t N>
+struct MatrixLU {
+    Matrix<T, N, N> lu{};
+    std::size_t pivot[N]{};
+    int sign = 1;
+    bool singular = false;
+
+    constexpr explicit MatrixLU(const Matrix<T, N, N>& m) : lu(m) {
+        auto abs = [](T x) { return x < T(0) ? -x : x; };
+
+        for (std::size_t i = 0; i < N; ++i)
+            pivot[i] = i;
+
+        for (std::size_t k = 0; k < N; ++k) {
+            std::size_t best = k;
+            for (std::size_t i = k + 1; i < N; ++i)
+                if (abs(lu.data[i][k]) > abs(lu.data[best][k]))
+                    best = i;
+
+            if (lu.data[best][k] == T(0)) {
+                singular = true;
+                continue;
+            }
+            if (best != k) {
+                for (std::size_t j = 0; j < N; ++j) {
+                    T tmp = lu.data[k][j];
+                    lu.data[k][j] = lu.data[best][j];
+                    lu.data[best][j] = tmp;
+                }
+                std::size_t tmp = pivot[k];
+                pivot[k] = pivot[best];
+                pivot[best] = tmp;
+                sign = -sign;
+            }
+
+            for (std::size_t i = k + 1; i < N; ++i) {
+                lu.data[i][k] /= lu.data[k][k];
+                for (std::size_t j = k + 1; j < N; ++j)
+                    lu.data[i][j] -= lu.data[i][k] * lu.data[k][j];
+            }
+        }
+    }
+
+    constexpr T determinant() const {
+        if (singular) return T(0);
+        T det = T(sign);
+        for (std::size_t i = 0; i < N; ++i)
+            det *= lu.data[i][i];
+        return det;
+    }
+
+    // Solve A x = b, x is left untouched when A is singular.
+    constexpr void solve(const T (&b)[N], T (&x)[N]) const {
+        if (singular) return;
+        for (std::size_t i = 0; i < N; ++i) {
+            T sum = b[pivot[i]];
+            for (std::size_t j = 0; j < i; ++j)
+                sum -= lu.data[i][j] * x[j];
+            x[i] = sum;
+        }
+        for (std::size_t i = N; i-- > 0;) {
+            T sum = x[i];
+            for (std::size_t j = i + 1; j < N; ++j)
+                sum -= lu.data[i][j] * x[j];
+            x[i] = sum / lu.data[i][i];
+        }
+    }
+
+    // Inverse column by column, zero matrix when singular.
+    constexpr Matrix<T, N, N> inverse() const {
+        Matrix<T, N, N> r{};
+        if (singular) return r;
+
+        for (std::size_t j = 0; j < N; ++j) {
+            T e[N]{};
+            T x[N]{};
+            e[j] = T(1);
+            solve(e, x);
+            for (std::size_t i = 0; i < N; ++i)
+                r.data[i][j] = x[i];
+        }
+        return r;
+    }
+};
+
+// ---------- SIMD kernels ----------
+// Same operation order as MatrixReference (0 + a0*b0 + a1*b1 + ...) and no fused multiply-add,
+// so the results are bit-identical to the generic template.
+#if defined(SYSTEM_SIMD_AVX) || defined(SYSTEM_SIMD_SSE)
+
+template <>
+struct MatrixKernel<float, 4, 4> : MatrixReference<float, 4, 4> {
+    template <std::size_t OTHER_COLS>
+    static void multiply(const float (&a)[4][4], const float (&b)[4][OTHER_COLS], float (&out)[4][OTHER_COLS]) {
+        if constexpr (OTHER_COLS != 4) {
+            MatrixReference<float, 4, 4>::multiply(a, b, out);
+        } else {
+            const __m128 b0 = _mm_loadu_ps(b[0]), b1 = _mm_loadu_ps(b[1]);
+            const __m128 b2 = _mm_loadu_ps(b[2]), b3 = _mm_loadu_ps(b[3]);
+
+            for (std::size_t i = 0; i < 4; ++i) {
+                __m128 acc = _mm_add_ps(_mm_setzero_ps(), _mm_mul_ps(_mm_set1_ps(a[i][0]), b0));
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(a[i][1]), b1));
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(a[i][2]), b2));
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(a[i][3]), b3));
+                _mm_storeu_ps(out[i], acc);
+            }
+        }
+    }
+
+    static void transpose(const float (&a)[4][4], float (&out)[4][4]) {
+        __m128 r0 = _mm_loadu_ps(a[0]), r1 = _mm_loadu_ps(a[1]);
+        __m128 r2 = _mm_loadu_ps(a[2]), r3 = _mm_loadu_ps(a[3]);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(out[0], r0);
+        _mm_storeu_ps(out[1], r1);
+        _mm_storeu_ps(out[2], r2);
+        _mm_storeu_ps(out[3], r3);
+    }
+
+    static void apply(const float (&a)[4][4], const float (&v)[4], float (&out)[4]) {
+        float t[4][4];
+        transpose(a, t);
+
+        __m128 acc = _mm_add_ps(_mm_setzero_ps(), _mm_mul_ps(_mm_loadu_ps(t[0]), _mm_set1_ps(v[0])));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(t[1]), _mm_set1_ps(v[1])));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(t[2]), _mm_set1_ps(v[2])));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(t[3]), _mm_set1_ps(v[3])));
+        _mm_storeu_ps(out, acc);
+    }
+};
+
+template <>
+struct MatrixKernel<double, 4, 4> : MatrixReference<double, 4, 4> {
+#if defined(SYSTEM_SIMD_AVX)
+    template <std::size_t OTHER_COLS>
+    static void multiply(const double (&a)[4][4], const double (&b)[4][OTHER_COLS], double (&out)[4][OTHER_COLS]) {
+        if constexpr (OTHER_COLS != 4) {
+            MatrixReference<double, 4, 4>::multiply(a, b, out);
+        } else {
+            const __m256d b0 = _mm256_loadu_pd(b[0]), b1 = _mm256_loadu_pd(b[1]);
+            const __m256d b2 = _mm256_loadu_pd(b[2]), b3 = _mm256_loadu_pd(b[3]);
+
+            for (std::size_t i = 0; i < 4; ++i) {
+                __m256d acc = _mm256_add_pd(_mm256_setzero_pd(), _mm256_mul_pd(_mm256_set1_pd(a[i][0]), b0));
+                acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_set1_pd(a[i][1]), b1));
+                acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_set1_pd(a[i][2]), b2));
+                acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_set1_pd(a[i][3]), b3));
+                _mm256_storeu_pd(out[i], acc);
+            }
+        }
+    }
+
+    static void transpose(const double (&a)[4][4], double (&out)[4][4]) {
+        const __m256d r0 = _mm256_loadu_pd(a[0]), r1 = _mm256_loadu_pd(a[1]);
+        const __m256d r2 = _mm256_loadu_pd(a[2]), r3 = _mm256_loadu_pd(a[3]);
+
+        const __m256d t0 = _mm256_unpacklo_pd(r0, r1); // a00 a10 a02 a12
+        const __m256d t1 = _mm256_unpackhi_pd(r0, r1); // a01 a11 a03 a13
+        const __m256d t2 = _mm256_unpacklo_pd(r2, r3); // a20 a30 a22 a32
+        const __m256d t3 = _mm256_unpackhi_pd(r2, r3); // a21 a31 a23 a33
+
+        _mm256_storeu_pd(out[0], _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(out[1], _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(out[2], _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(out[3], _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+
+    static void apply(const double (&a)[4][4], const double (&v)[4], double (&out)[4]) {
+        double t[4][4];
+        transpose(a, t);
+
+        __m256d acc = _mm256_add_pd(_mm256_setzero_pd(), _mm256_mul_pd(_mm256_loadu_pd(t[0]), _mm256_set1_pd(v[0])));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(t[1]), _mm256_set1_pd(v[1])));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(t[2]), _mm256_set1_pd(v[2])));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(t[3]), _mm256_set1_pd(v[3])));
+        _mm256_storeu_pd(out, acc);
+    }
+#else
+    // SSE2: every row is handled as two halves of two doubles.
+    template <std::size_t OTHER_COLS>
+    static void multiply(const double (&a)[4][4], const double (&b)[4][OTHER_COLS], double (&out)[4][OTHER_COLS]) {
+        if constexpr (OTHER_COLS != 4) {
+            MatrixReference<double, 4, 4>::multiply(a, b, out);
+        } else {
+            for (std::size_t h = 0; h < 4; h += 2) {
+                const __m128d b0 = _mm_loadu_pd(b[0] + h), b1 = _mm_loadu_pd(b[1] + h);
+                const __m128d b2 = _mm_loadu_pd(b[2] + h), b3 = _mm_loadu_pd(b[3] + h);
+
+                for (std::size_t i = 0; i < 4; ++i) {
+                    __m128d acc = _mm_add_pd(_mm_setzero_pd(), _mm_mul_pd(_mm_set1_pd(a[i][0]), b0));
+                    acc = _mm_add_pd(acc, _mm_mul_pd(_mm_set1_pd(a[i][1]), b1));
+                    acc = _mm_add_pd(acc, _mm_mul_pd(_mm_set1_pd(a[i][2]), b2));
+                    acc = _mm_add_pd(acc, _mm_mul_pd(_mm_set1_pd(a[i][3]), b3));
+                    _mm_storeu_pd(out[i] + h, acc);
+                }
+            }
+        }
+    }
+
+    static void transpose(const double (&a)[4][4], double (&out)[4][4]) {
+        for (std::size_t i = 0; i < 4; i += 2)
+            for (std::size_t j = 0; j < 4; j += 2) {
+                const __m128d r0 = _mm_loadu_pd(a[i] + j), r1 = _mm_loadu_pd(a[i + 1] + j);
+                _mm_storeu_pd(out[j] + i, _mm_unpacklo_pd(r0, r1));
+                _mm_storeu_pd(out[j + 1] + i, _mm_unpackhi_pd(r0, r1));
+            }
+    }
+
+    static void apply(const double (&a)[4][4], const double (&v)[4], double (&out)[4]) {
+        double t[4][4];
+        transpose(a, t);
+
+        for (std::size_t h = 0; h < 4; h += 2) {
+            __m128d acc = _mm_add_pd(_mm_setzero_pd(), _mm_mul_pd(_mm_loadu_pd(t[0] + h), _mm_set1_pd(v[0])));
+            acc = _mm_add_pd(acc, _mm_mul_pd(_mm_loadu_pd(t[1] + h), _mm_set1_pd(v[1])));
+            acc = _mm_add_pd(acc, _mm_mul_pd(_mm_loadu_pd(t[2] + h), _mm_set1_pd(v[2])));
+            acc = _mm_add_pd(acc, _mm_mul_pd(_mm_loadu_pd(t[3] + h), _mm_set1_pd(v[3])));
+            _mm_storeu_pd(out + h, acc);
+        }
+    }
+#endif
+};
+
+#endif
+
 // ---------- Aliases ----------
 using Matrix3x3 = Matrix<double, 3, 3>;
-using Matrix4x4 = Matrix<double, 4, 4>;
\ No newline at end of file
+using Matrix4x4 = Matrix<double, 4, 4>;
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template struct Matrix<double, 3, 3>;
+extern template struct Matrix<double, 4, 4>;
+#endif
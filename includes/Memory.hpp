@@ -0,0 +1,280 @@
+/**
+ * @file Memory.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Monotonic arena and fixed size pool, both std::pmr memory resources
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+/**
+ * Geometry built for one frame (triangulations, meshes, candidate lists) is released all at
+ * once, so paying for individual frees is wasted work. Both resources carve memory from chunks
+ * obtained from an upstream resource and keep those chunks on reset(): after the first frame
+ * a reset() / rebuild cycle does not touch the upstream resource at all.
+ *
+ * - MonotonicArena: bump allocation of any size, deallocate is a no-op, reset() releases
+ *   everything in O(1).
+ * - FixedPool: blocks of one size with a free list, for node based containers
+ *   (std::pmr::list / set / map) that free elements one by one. Larger requests are forwarded
+ *   to the upstream resource.
+ *
+ * Use them through std::pmr containers or the algorithms taking a std::pmr::memory_resource*
+ * (Delaunay, FlatSet). The resource must outlive every container using it, and reset()
+ * must only be called once those containers are gone or cleared. Neither is thread safe.
+ */
+
+namespace memory_detail {
+
+    constexpr std::size_t alignUp(std::size_t value, std::size_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    inline std::byte* alignUp(std::byte* p, std::size_t alignment) {
+        return reinterpret_cast<std::byte*>(alignUp(reinterpret_cast<std::uintptr_t>(p), alignment));
+    }
+
+    // Chunk header, the memory of the chunk follows it.
+    struct alignas(std::max_align_t) Chunk {
+        Chunk* next;
+        std::size_t size;   // bytes after the header
+
+        std::byte* begin() { return reinterpret_cast<std::byte*>(this + 1); }
+        std::byte* end() { return begin() + size; }
+    };
+
+    // Singly linked list of chunks taken from `upstream`, in allocation order.
+    class ChunkList {
+        public:
+            explicit ChunkList(std::pmr::memory_resource* upstream) : _upstream(upstream) {}
+            ~ChunkList() { release(); }
+
+            ChunkList(const ChunkList&) = delete;
+            ChunkList& operator=(const ChunkList&) = delete;
+
+            Chunk* head() const { return _head; }
+            std::pmr::memory_resource* upstream() const { return _upstream; }
+            std::size_t capacity() const { return _capacity; }
+
+            Chunk* append(std::size_t size) {
+                void* p = _upstream->allocate(sizeof(Chunk) + size, alignof(Chunk));
+                Chunk* chunk = ::new (p) Chunk{nullptr, size};
+                (_tail ? _tail->next : _head) = chunk;
+                _tail = chunk;
+                _capacity += size;
+                return chunk;
+            }
+
+            void release() {
+                while (_head) {
+                    Chunk* next = _head->next;
+                    _upstream->deallocate(_head, sizeof(Chunk) + _head->size, alignof(Chunk));
+                    _head = next;
+                }
+                _tail = nullptr;
+                _capacity = 0;
+            }
+
+        private:
+            std::pmr::memory_resource* _upstream;
+            Chunk* _head = nullptr;
+            Chunk* _tail = nullptr;
+            std::size_t _capacity = 0;
+    };
+
+} // namespace memory_detail
+
+// ---------- Monotonic arena ----------
+/**
+ * @brief bump allocator, frees everything at once
+ *
+ * Chunks start at `chunkSize` bytes and double each time a new one is needed. A request that
+ * does not fit the rest of the current chunk moves on to the next kept chunk (after a reset())
+ * or a new one; the rest of the skipped chunk is wasted until the next reset().
+ */
+class MonotonicArena : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t defaultChunkSize = 64 * 1024;
+
+        explicit MonotonicArena(std::size_t chunkSize = defaultChunkSize,
+                                std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : _chunks(upstream), _nextSize(std::max<std::size_t>(chunkSize, 256)) {}
+
+        MonotonicArena(const MonotonicArena&) = delete;
+        MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+        // Every allocation is released, the chunks are kept for the next ones. O(1).
+        void reset() {
+            _current = _chunks.head();
+            _cursor = _current ? _current->begin() : nullptr;
+            _used = 0;
+        }
+
+        // Every allocation is released and the chunks go back to the upstream resource.
+        void release() {
+            _chunks.release();
+            _current = nullptr;
+            _cursor = nullptr;
+            _used = 0;
+        }
+
+        // Bytes handed out since the last reset(), alignment padding included.
+        std::size_t used() const { return _used; }
+
+        // Bytes held in chunks.
+        std::size_t capacity() const { return _chunks.capacity(); }
+
+        std::pmr::memory_resource* upstream() const { return _chunks.upstream(); }
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            for (;;) {
+                if (_current) {
+                    std::byte* p = memory_detail::alignUp(_cursor, alignment);
+                    if (p <= _current->end() && std::size_t(_current->end() - p) >= bytes) {
+                        _used += std::size_t(p - _cursor) + bytes;
+                        _cursor = p + bytes;
+                        return p;
+                    }
+                    if (_current->next) {
+                        _current = _current->next;
+                        _cursor = _current->begin();
+                        continue;
+                    }
+                }
+
+                const std::size_t size = std::max(_nextSize, memory_detail::alignUp(bytes + alignment, alignof(std::max_align_t)));
+                _nextSize = std::max(_nextSize, size) * 2;
+                _current = _chunks.append(size);
+                _cursor = _current->begin();
+            }
+        }
+
+        void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        memory_detail::ChunkList _chunks;
+        memory_detail::Chunk* _current = nullptr;
+        std::byte* _cursor = nullptr;
+        std::size_t _nextSize;
+        std::size_t _used = 0;
+};
+
+// ---------- Fixed size pool ----------
+/**
+ * @brief blocks of one size, freed blocks are reused first
+ *
+ * Blocks are aligned for any type (max_align_t). A `blockSize` of 0 takes the size of the
+ * first request, which is the node size of the std::pmr::list / set / map using the pool.
+ * Requests larger than a block, or with a stronger alignment, go to the upstream resource.
+ */
+class FixedPool : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t defaultBlocksPerChunk = 256;
+
+        explicit FixedPool(std::size_t blockSize = 0, std::size_t blocksPerChunk = defaultBlocksPerChunk,
+                           std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : _chunks(upstream), _blocksPerChunk(std::max<std::size_t>(blocksPerChunk, 1)) {
+            if (blockSize)
+                setBlockSize(blockSize);
+        }
+
+        FixedPool(const FixedPool&) = delete;
+        FixedPool& operator=(const FixedPool&) = delete;
+
+        // 0 until the first allocation when constructed with a block size of 0.
+        std::size_t blockSize() const { return _blockSize; }
+
+        // Every block is free again, the chunks are kept. O(1).
+        void reset() {
+            _free = nullptr;
+            _current = _chunks.head();
+            _cursor = _current ? _current->begin() : nullptr;
+            _inUse = 0;
+        }
+
+        // Every block is freed and the chunks go back to the upstream resource.
+        void release() {
+            _chunks.release();
+            _free = nullptr;
+            _current = nullptr;
+            _cursor = nullptr;
+            _inUse = 0;
+        }
+
+        // Blocks currently allocated.
+        std::size_t inUse() const { return _inUse; }
+
+        // Bytes held in chunks.
+        std::size_t capacity() const { return _chunks.capacity(); }
+
+        std::pmr::memory_resource* upstream() const { return _chunks.upstream(); }
+
+    private:
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        void setBlockSize(std::size_t size) {
+            _blockSize = memory_detail::alignUp(std::max(size, sizeof(FreeBlock)), alignof(std::max_align_t));
+        }
+
+        bool fits(std::size_t bytes, std::size_t alignment) const {
+            return bytes <= _blockSize && alignment <= alignof(std::max_align_t);
+        }
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            if (_blockSize == 0)
+                setBlockSize(bytes);
+            if (!fits(bytes, alignment))
+                return _chunks.upstream()->allocate(bytes, alignment);
+
+            ++_inUse;
+            if (_free) {
+                FreeBlock* block = _free;
+                _free = block->next;
+                return block;
+            }
+            for (;;) {
+                if (_current) {
+                    if (std::size_t(_current->end() - _cursor) >= _blockSize) {
+                        void* p = _cursor;
+                        _cursor += _blockSize;
+                        return p;
+                    }
+                    if (_current->next) {
+                        _current = _current->next;
+                        _cursor = _current->begin();
+                        continue;
+                    }
+                }
+                _current = _chunks.append(_blockSize * _blocksPerChunk);
+                _cursor = _current->begin();
+            }
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+            if (!fits(bytes, alignment)) {
+                _chunks.upstream()->deallocate(p, bytes, alignment);
+                return;
+            }
+            --_inUse;
+            _free = ::new (p) FreeBlock{_free};
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        memory_detail::ChunkList _chunks;
+        std::size_t _blocksPerChunk;
+        std::size_t _blockSize = 0;
+        FreeBlock* _free = nullptr;
+        memory_detail::Chunk* _current = nullptr;
+        std::byte* _cursor = nullptr;
+        std::size_t _inUse = 0;
+};
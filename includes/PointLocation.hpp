@@ -0,0 +1,161 @@
+/**
+ * @file PointLocation.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Batched point-in-triangle tests and point location over indexed triangle sets
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "AabbTree.hpp"
+#include "Shape.hpp"
+#include "Simd.hpp"
+#include "VectorArray.hpp"
+
+// ---------- Batched point in triangle ----------
+/**
+ * @brief inside[i] = triangle.isInside(points[i]), returns the number of points inside
+ *
+ * The three edge functions are evaluated one SIMD pack of points at a time with the orient2d
+ * forward error filter (Shewchuk's bound for the precision of T). Lanes whose sign is not
+ * certain for some edge (points on or very near an edge) go through the exact
+ * Triangle::isInside, so the result is always identical to the scalar test. Integer
+ * coordinates use the scalar test.
+ */
+template <typename T>
+std::size_t insideTriangle(const Triangle<T>& triangle, const Vector2Array<T>& points, std::span<std::uint8_t> inside) {
+    const std::size_t n = points.size();
+    const T* px = points.lane(0);
+    const T* py = points.lane(1);
+    std::size_t count = 0;
+
+    if constexpr (!std::is_floating_point<T>::value) {
+        for (std::size_t i = 0; i < n; ++i)
+            count += inside[i] = triangle.isInside(points[i]);
+        return count;
+    } else {
+        constexpr T half = std::numeric_limits<T>::epsilon() / T(2);
+        constexpr T errBound = (T(3) + T(16) * half) * half;
+        const Vector2<T> v[3] = {triangle.p1, triangle.p2, triangle.p3};
+
+        simd::for_each<T>(n, [&](auto p, std::size_t i) {
+            using P = decltype(p);
+            const P x = P::load(px + i), y = P::load(py + i);
+            const P zero = P::broadcast(T(0));
+            const unsigned all = (1u << P::width) - 1u;
+
+            // orient2d(a, b, point) with its forward error bound, same expression as Predicates.hpp
+            unsigned positive = 0, negative = 0, certain = all;
+            for (std::size_t e = 0; e < 3; ++e) {
+                const Vector2<T>& a = v[e];
+                const Vector2<T>& b = v[(e + 1) % 3];
+                const P left = (P::broadcast(a.x) - x) * (P::broadcast(b.y) - y);
+                const P right = (P::broadcast(a.y) - y) * (P::broadcast(b.x) - x);
+                const P det = left - right;
+                const P bound = P::broadcast(errBound) * (max(left, zero - left) + max(right, zero - right));
+
+                const unsigned pos = P::bits(gt(det, bound));
+                const unsigned neg = P::bits(lt(det, zero - bound));
+                positive |= pos;
+                negative |= neg;
+                certain &= pos | neg;
+            }
+
+            const unsigned in = ~(positive & negative) & all;
+            for (std::size_t l = 0; l < P::width; ++l) {
+                const bool r = (certain >> l) & 1u ? bool((in >> l) & 1u)
+                                                   : triangle.isInside(Vector2<T>{px[i + l], py[i + l]});
+                inside[i + l] = r;
+                count += r;
+            }
+        });
+        return count;
+    }
+}
+
+// ---------- Point location ----------
+/**
+ * @brief answers "which triangle of an indexed set contains p"
+ *
+ * Triangle bounds go into an AabbTree (data = face index) rebuilt top-down once all faces
+ * are in, so a query descends it in O(log n) and tests the few overlapping candidates with
+ * the exact Triangle::isInside. Points on a shared edge or vertex report the lowest face
+ * index, points outside every face `none`.
+ * Faces use the Delaunay<T>::Face layout, so a triangulation can be located directly.
+ */
+template <typename T>
+class TriangleLocator {
+    public:
+        using Index = std::uint32_t;
+        using Face = std::array<Index, 3>;
+
+        static constexpr Index none = std::numeric_limits<Index>::max();
+
+        TriangleLocator() = default;
+        TriangleLocator(std::span<const Vector2<T>> vertices, std::span<const Face> faces) { build(vertices, faces); }
+
+        std::size_t size() const { return _triangles.size(); }
+        const Triangle<T>& triangle(Index face) const { return _triangles[face]; }
+
+        void build(std::span<const Vector2<T>> vertices, std::span<const Face> faces) {
+            _tree = AabbTree<double>();
+            _triangles.resize(faces.size());
+            for (std::size_t f = 0; f < faces.size(); ++f) {
+                const Triangle<T> t{vertices[faces[f][0]], vertices[faces[f][1]], vertices[faces[f][2]]};
+                _triangles[f] = t;
+                _tree.insert(bounds(t), Index(f));
+            }
+            _tree.rebuild();
+        }
+
+        Index locate(const Vector2<T>& p) const {
+            Index found = none;
+            _tree.query(Rect<double>{double(p.x), double(p.y), 0.0, 0.0}, [&](AabbTree<double>::Proxy proxy) {
+                const Index face = _tree.data(proxy);
+                if (face < found && _triangles[face].isInside(p))
+                    found = face;
+                return true;
+            });
+            return found;
+        }
+
+        // out[i] = locate(points[i])
+        void locate(std::span<const Vector2<T>> points, std::span<Index> out) const {
+            for (std::size_t i = 0; i < points.size(); ++i)
+                out[i] = locate(points[i]);
+        }
+
+    private:
+        /*
+         * Bounding box in the Rect (centre, size) form, in double. The centre and half size are
+         * rounded, so the box is padded by a few ulps of its coordinates: a point on the border
+         * of the triangle must still overlap it.
+         */
+        static Rect<double> bounds(const Triangle<T>& t) {
+            const double lo[2] = {std::min({double(t.p1.x), double(t.p2.x), double(t.p3.x)}),
+                                  std::min({double(t.p1.y), double(t.p2.y), double(t.p3.y)})};
+            const double hi[2] = {std::max({double(t.p1.x), double(t.p2.x), double(t.p3.x)}),
+                                  std::max({double(t.p1.y), double(t.p2.y), double(t.p3.y)})};
+            double size[2];
+            for (std::size_t k = 0; k < 2; ++k)
+                size[k] = (hi[k] - lo[k]) + 8.0 * std::numeric_limits<double>::epsilon() * (std::abs(lo[k]) + std::abs(hi[k]));
+            return {(lo[0] + hi[0]) / 2.0, (lo[1] + hi[1]) / 2.0, size[0], size[1]};
+        }
+
+        AabbTree<double> _tree;
+        std::vector<Triangle<T>> _triangles;
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class TriangleLocator<double>;
+#endif
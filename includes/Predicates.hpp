@@ -0,0 +1,386 @@
+/**
+ * @file Predicates.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Adaptive precision orient2d / incircle predicates (Shewchuk style)
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "Vector2.hpp"
+
+/**
+ * Each predicate first evaluates the determinant in plain double precision together with a
+ * bound on its rounding error. When |det| is above the bound the sign is certain (the filter
+ * "hits"). Otherwise the determinant of the rounded differences is computed exactly with
+ * floating point expansions (exact answer when the differences had no rounding error), and
+ * only then the full exact determinant.
+ *
+ * Coordinates are converted to double, exact for float and for integers up to 2^53.
+ * Sign convention (same as Shewchuk):
+ * - orient2d(a, b, c) > 0 when a, b, c are counter-clockwise, 0 when collinear,
+ * - incircle(a, b, c, d) > 0 when d is inside the circle through the counter-clockwise a, b, c.
+ */
+namespace predicates {
+
+    // ---------- Error bounds ----------
+    constexpr double epsilon = 0x1p-53; // half an ulp of 1
+    constexpr double ccwErrBound = (3.0 + 16.0 * epsilon) * epsilon;
+    constexpr double ccwErrBoundB = (2.0 + 12.0 * epsilon) * epsilon;
+    constexpr double iccErrBound = (10.0 + 96.0 * epsilon) * epsilon;
+    constexpr double iccErrBoundB = (4.0 + 48.0 * epsilon) * epsilon;
+
+    // ---------- Error free transformations ----------
+    // a + b = x + y exactly, |a| >= |b| required
+    inline void fastTwoSum(double a, double b, double& x, double& y) {
+        x = a + b;
+        y = b - (x - a);
+    }
+
+    // a + b = x + y exactly
+    inline void twoSum(double a, double b, double& x, double& y) {
+        x = a + b;
+        const double bv = x - a;
+        const double av = x - bv;
+        y = (a - av) + (b - bv);
+    }
+
+    // a - b = x + y exactly
+    inline void twoDiff(double a, double b, double& x, double& y) {
+        x = a - b;
+        const double bv = a - x;
+        const double av = x + bv;
+        y = (a - av) + (bv - b);
+    }
+
+    // a * b = x + y exactly
+    inline void twoProduct(double a, double b, double& x, double& y) {
+        x = a * b;
+#if defined(__FMA__)
+        y = std::fma(a, b, -x);
+#else
+        constexpr double splitter = 134217729.0; // 2^27 + 1
+        auto split = [](double v, double& hi, double& lo) {
+            const double c = splitter * v;
+            hi = c - (c - v);
+            lo = v - hi;
+        };
+        double ahi, alo, bhi, blo;
+        split(a, ahi, alo);
+        split(b, bhi, blo);
+        y = alo * blo - (((x - ahi * bhi) - alo * bhi) - ahi * blo);
+#endif
+    }
+
+    // ---------- Expansions ----------
+    /**
+     * @brief exact sum of n non-overlapping doubles, e[0] is the smallest in magnitude
+     *
+     * Capacity N is the worst case length, zero components are dropped so the real length
+     * `n` usually stays far below it.
+     */
+    template <std::size_t N>
+    struct Expansion {
+        std::array<double, N> e;
+        std::size_t n = 0;
+
+        // The most significant component, it carries the sign of the whole sum.
+        double estimate() const { return n ? e[n - 1] : 0.0; }
+
+        // Rounded value of the whole sum.
+        double approximate() const {
+            double r = 0.0;
+            for (std::size_t i = 0; i < n; ++i)
+                r += e[i];
+            return r;
+        }
+    };
+
+    // x + y as an expansion, a zero tail is dropped.
+    inline Expansion<2> expansion(double x, double y) {
+        Expansion<2> r;
+        r.e[0] = y != 0.0 ? y : x;
+        r.e[1] = x;
+        r.n = y != 0.0 ? 2 : 1;
+        return r;
+    }
+
+    inline Expansion<2> product(double a, double b) {
+        double x, y;
+        twoProduct(a, b, x, y);
+        return expansion(x, y);
+    }
+
+    inline Expansion<2> difference(double a, double b) {
+        double x, y;
+        twoDiff(a, b, x, y);
+        return expansion(x, y);
+    }
+
+    // h = e + f (fast_expansion_sum_zeroelim), returns the length of h
+    inline std::size_t sum(const double* e, std::size_t en, const double* f, std::size_t fn, double* h) {
+        std::size_t ei = 0, fi = 0, hi = 0;
+        double enow = e[0], fnow = f[0], q, qn, hh;
+        auto nextE = [&] { enow = ++ei < en ? e[ei] : 0.0; };
+        auto nextF = [&] { fnow = ++fi < fn ? f[fi] : 0.0; };
+
+        if ((fnow > enow) == (fnow > -enow)) { q = enow; nextE(); }
+        else { q = fnow; nextF(); }
+
+        if (ei < en && fi < fn) {
+            if ((fnow > enow) == (fnow > -enow)) { fastTwoSum(enow, q, qn, hh); nextE(); }
+            else { fastTwoSum(fnow, q, qn, hh); nextF(); }
+            q = qn;
+            if (hh != 0.0)
+                h[hi++] = hh;
+
+            while (ei < en && fi < fn) {
+                if ((fnow > enow) == (fnow > -enow)) { twoSum(q, enow, qn, hh); nextE(); }
+                else { twoSum(q, fnow, qn, hh); nextF(); }
+                q = qn;
+                if (hh != 0.0)
+                    h[hi++] = hh;
+            }
+        }
+        for (; ei < en; nextE()) {
+            twoSum(q, enow, qn, hh);
+            q = qn;
+            if (hh != 0.0)
+                h[hi++] = hh;
+        }
+        for (; fi < fn; nextF()) {
+            twoSum(q, fnow, qn, hh);
+            q = qn;
+            if (hh != 0.0)
+                h[hi++] = hh;
+        }
+        if (q != 0.0 || hi == 0)
+            h[hi++] = q;
+        return hi;
+    }
+
+    // h = e * b (scale_expansion_zeroelim), returns the length of h
+    inline std::size_t scale(const double* e, std::size_t en, double b, double* h) {
+        std::size_t hi = 0;
+        double q, hh, p1, p0, s;
+
+        twoProduct(e[0], b, q, hh);
+        if (hh != 0.0)
+            h[hi++] = hh;
+        for (std::size_t i = 1; i < en; ++i) {
+            twoProduct(e[i], b, p1, p0);
+            twoSum(q, p0, s, hh);
+            if (hh != 0.0)
+                h[hi++] = hh;
+            fastTwoSum(p1, s, q, hh);
+            if (hh != 0.0)
+                h[hi++] = hh;
+        }
+        if (q != 0.0 || hi == 0)
+            h[hi++] = q;
+        return hi;
+    }
+
+    template <std::size_t N, std::size_t M>
+    Expansion<N + M> operator+(const Expansion<N>& a, const Expansion<M>& b) {
+        Expansion<N + M> r;
+        r.n = sum(a.e.data(), a.n, b.e.data(), b.n, r.e.data());
+        return r;
+    }
+
+    template <std::size_t N>
+    Expansion<N> operator-(Expansion<N> a) {
+        for (std::size_t i = 0; i < a.n; ++i)
+            a.e[i] = -a.e[i];
+        return a;
+    }
+
+    template <std::size_t N, std::size_t M>
+    Expansion<N + M> operator-(const Expansion<N>& a, const Expansion<M>& b) { return a + -b; }
+
+    // Sum of a scaled by every component of b.
+    template <std::size_t N, std::size_t M>
+    Expansion<2 * N * M> operator*(const Expansion<N>& a, const Expansion<M>& b) {
+        Expansion<2 * N * M> r, tmp;
+        double scaled[2 * N];
+
+        // ping-pong between r and tmp, only the used part is copied back
+        Expansion<2 * N * M>* cur = &r;
+        Expansion<2 * N * M>* next = &tmp;
+        r.n = scale(a.e.data(), a.n, b.e[0], r.e.data());
+        for (std::size_t i = 1; i < b.n; ++i) {
+            const std::size_t sn = scale(a.e.data(), a.n, b.e[i], scaled);
+            next->n = sum(cur->e.data(), cur->n, scaled, sn, next->e.data());
+            std::swap(cur, next);
+        }
+        if (cur != &r) {
+            std::copy(tmp.e.begin(), tmp.e.begin() + std::ptrdiff_t(tmp.n), r.e.begin());
+            r.n = tmp.n;
+        }
+        return r;
+    }
+
+    // ---------- orient2d ----------
+    // Fast path, also gives the magnitude `detsum` the later error bounds scale with.
+    inline bool orient2dFilter(double ax, double ay, double bx, double by, double cx, double cy, double& det, double& detsum) {
+        const double left = (ax - cx) * (by - cy);
+        const double right = (ay - cy) * (bx - cx);
+        det = left - right;
+
+        if (left > 0.0) {
+            if (right <= 0.0)
+                return true;
+            detsum = left + right;
+        } else if (left < 0.0) {
+            if (right >= 0.0)
+                return true;
+            detsum = -left - right;
+        } else {
+            return true;
+        }
+        const double bound = ccwErrBound * detsum;
+        return det >= bound || -det >= bound;
+    }
+
+    /**
+     * @brief fast path of orient2d
+     * @return false when the rounding error may hide the sign, `det` is the approximation
+     */
+    inline bool orient2dFilter(double ax, double ay, double bx, double by, double cx, double cy, double& det) {
+        double detsum = 0.0;
+        return orient2dFilter(ax, ay, bx, by, cx, cy, det, detsum);
+    }
+
+    inline double orient2dExact(double ax, double ay, double bx, double by, double cx, double cy) {
+        const auto a = product(ax, by) - product(ay, bx);
+        const auto b = product(bx, cy) - product(by, cx);
+        const auto c = product(cx, ay) - product(cy, ax);
+        return (a + b + c).estimate();
+    }
+
+    // Exact determinant of the rounded differences, it is the true one when they have no tail.
+    inline double orient2dAdapt(double ax, double ay, double bx, double by, double cx, double cy, double detsum) {
+        double acx, acxTail, bcx, bcxTail, acy, acyTail, bcy, bcyTail;
+        twoDiff(ax, cx, acx, acxTail);
+        twoDiff(bx, cx, bcx, bcxTail);
+        twoDiff(ay, cy, acy, acyTail);
+        twoDiff(by, cy, bcy, bcyTail);
+
+        const auto b = product(acx, bcy) - product(acy, bcx);
+        const double det = b.approximate();
+        const double bound = ccwErrBoundB * detsum;
+        if (det >= bound || -det >= bound)
+            return det;
+        if (acxTail == 0.0 && bcxTail == 0.0 && acyTail == 0.0 && bcyTail == 0.0)
+            return b.estimate();
+        return orient2dExact(ax, ay, bx, by, cx, cy);
+    }
+
+    inline double orient2d(double ax, double ay, double bx, double by, double cx, double cy) {
+        double det, detsum;
+        if (orient2dFilter(ax, ay, bx, by, cx, cy, det, detsum))
+            return det;
+        return orient2dAdapt(ax, ay, bx, by, cx, cy, detsum);
+    }
+
+    // ---------- incircle ----------
+    // Fast path, also gives the `permanent` the later error bounds scale with.
+    inline bool incircleFilter(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy,
+                               double& det, double& permanent) {
+        const double adx = ax - dx, ady = ay - dy;
+        const double bdx = bx - dx, bdy = by - dy;
+        const double cdx = cx - dx, cdy = cy - dy;
+
+        const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+        const double cdxady = cdx * ady, adxcdy = adx * cdy;
+        const double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+        const double alift = adx * adx + ady * ady;
+        const double blift = bdx * bdx + bdy * bdy;
+        const double clift = cdx * cdx + cdy * cdy;
+
+        det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+
+        permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift
+                  + (std::abs(cdxady) + std::abs(adxcdy)) * blift
+                  + (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+        const double bound = iccErrBound * permanent;
+        return det > bound || -det > bound;
+    }
+
+    /**
+     * @brief fast path of incircle
+     * @return false when the rounding error may hide the sign, `det` is the approximation
+     */
+    inline bool incircleFilter(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy, double& det) {
+        double permanent;
+        return incircleFilter(ax, ay, bx, by, cx, cy, dx, dy, det, permanent);
+    }
+
+    inline double incircleExact(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy) {
+        // Translated differences are exact 2 component expansions, most of the time one component.
+        const auto adx = difference(ax, dx), ady = difference(ay, dy);
+        const auto bdx = difference(bx, dx), bdy = difference(by, dy);
+        const auto cdx = difference(cx, dx), cdy = difference(cy, dy);
+
+        const auto a = (adx * adx + ady * ady) * (bdx * cdy - cdx * bdy);
+        const auto b = (bdx * bdx + bdy * bdy) * (cdx * ady - adx * cdy);
+        const auto c = (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady);
+        return (a + b + c).estimate();
+    }
+
+    // Exact determinant of the rounded differences, it is the true one when they have no tail.
+    inline double incircleAdapt(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy, double permanent) {
+        double adx, adxTail, bdx, bdxTail, cdx, cdxTail;
+        double ady, adyTail, bdy, bdyTail, cdy, cdyTail;
+        twoDiff(ax, dx, adx, adxTail);
+        twoDiff(bx, dx, bdx, bdxTail);
+        twoDiff(cx, dx, cdx, cdxTail);
+        twoDiff(ay, dy, ady, adyTail);
+        twoDiff(by, dy, bdy, bdyTail);
+        twoDiff(cy, dy, cdy, cdyTail);
+
+        const auto a = (product(adx, adx) + product(ady, ady)) * (product(bdx, cdy) - product(cdx, bdy));
+        const auto b = (product(bdx, bdx) + product(bdy, bdy)) * (product(cdx, ady) - product(adx, cdy));
+        const auto c = (product(cdx, cdx) + product(cdy, cdy)) * (product(adx, bdy) - product(bdx, ady));
+        const auto fin = a + b + c;
+
+        const double det = fin.approximate();
+        const double bound = iccErrBoundB * permanent;
+        if (det >= bound || -det >= bound)
+            return det;
+        if (adxTail == 0.0 && bdxTail == 0.0 && cdxTail == 0.0 && adyTail == 0.0 && bdyTail == 0.0 && cdyTail == 0.0)
+            return fin.estimate();
+        return incircleExact(ax, ay, bx, by, cx, cy, dx, dy);
+    }
+
+    inline double incircle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy) {
+        double det, permanent;
+        if (incircleFilter(ax, ay, bx, by, cx, cy, dx, dy, det, permanent))
+            return det;
+        return incircleAdapt(ax, ay, bx, by, cx, cy, dx, dy, permanent);
+    }
+
+} // namespace predicates
+
+// ---------- Vector2 front ends ----------
+// > 0 counter-clockwise, < 0 clockwise, exactly 0 when collinear
+template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+double orient2d(const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& c) {
+    return predicates::orient2d(double(a.x), double(a.y), double(b.x), double(b.y), double(c.x), double(c.y));
+}
+
+// > 0 when d is inside the circumcircle of the counter-clockwise triangle abc, exactly 0 when cocircular
+template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+double incircle(const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& c, const Vector2<T>& d) {
+    return predicates::incircle(double(a.x), double(a.y), double(b.x), double(b.y),
+                                double(c.x), double(c.y), double(d.x), double(d.y));
+}
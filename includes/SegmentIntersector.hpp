@@ -0,0 +1,182 @@
+/**
+ * @file SegmentIntersector.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief All intersecting pairs of a Line collection, grid accelerated
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Shape.hpp"
+
+/**
+ * @brief finds every pair (a, b), a < b, with lines[a].intersects(lines[b])
+ *
+ * Segments are rasterised conservatively into a uniform grid: for every row of cells the
+ * segment crosses, the covered column range is computed from the segment's x extent within
+ * that row, padded against rounding. Cells are stored with a counting sort (one prefix-summed
+ * start array, no per-cell vectors). Pairs sharing a cell are filtered by bounding box, then
+ * tested with the exact Line::intersects; pairs found in several cells are removed by a final
+ * sort. The work is O(n + cells crossed + pairs sharing a cell + k log k) for k reported
+ * pairs, against O(n^2) for the loop.
+ *
+ * The cell size is given at construction, 0 picks about twice the mean segment extent. It is
+ * grown when the bounding box would need more than ~4 cells per segment. Every buffer is kept
+ * between calls.
+ */
+template <typename T>
+class SegmentIntersector {
+    static_assert(std::is_arithmetic<T>::value, "SegmentIntersector needs an arithmetic coordinate type");
+
+    public:
+        using Index = std::uint32_t;
+        using Pair = std::pair<Index, Index>;
+
+        explicit SegmentIntersector(T cellSize = T(0)) : _requested(double(cellSize)) {}
+
+        const std::vector<Pair>& pairs() const { return _pairs; }
+        double cellSize() const { return _cell; }
+
+        // Pairs sorted by (a, b), the buffer is reused by the next update().
+        const std::vector<Pair>& update(std::span<const Line<T>> lines) {
+            _pairs.clear();
+            if (lines.size() < 2)
+                return _pairs;
+
+            layout(lines);
+            fillCells(lines);
+
+            for (std::size_t c = 0; c + 1 < _cellStart.size(); ++c) {
+                const Index* first = _entries.data() + _cellStart[c];
+                const Index* last = _entries.data() + _cellStart[c + 1];
+                for (const Index* a = first; a != last; ++a) {
+                    for (const Index* b = a + 1; b != last; ++b) {
+                        if (!overlap(*a, *b) || !lines[*a].intersects(lines[*b]))
+                            continue;
+                        _pairs.push_back(*a < *b ? Pair{*a, *b} : Pair{*b, *a});
+                    }
+                }
+            }
+
+            std::sort(_pairs.begin(), _pairs.end());
+            _pairs.erase(std::unique(_pairs.begin(), _pairs.end()), _pairs.end());
+            return _pairs;
+        }
+
+    private:
+        struct Box {
+            double lo[2], hi[2];
+        };
+
+        bool overlap(Index a, Index b) const {
+            const Box& p = _boxes[a];
+            const Box& q = _boxes[b];
+            return !(p.hi[0] < q.lo[0] || p.lo[0] > q.hi[0] || p.hi[1] < q.lo[1] || p.lo[1] > q.hi[1]);
+        }
+
+        void layout(std::span<const Line<T>> lines) {
+            _boxes.resize(lines.size());
+            double lo[2] = {double(lines[0].p1.x), double(lines[0].p1.y)}, hi[2] = {lo[0], lo[1]};
+            double extent = 0.0;
+            for (std::size_t i = 0; i < lines.size(); ++i) {
+                const double x1 = double(lines[i].p1.x), y1 = double(lines[i].p1.y);
+                const double x2 = double(lines[i].p2.x), y2 = double(lines[i].p2.y);
+                Box& b = _boxes[i];
+                b = {{std::min(x1, x2), std::min(y1, y2)}, {std::max(x1, x2), std::max(y1, y2)}};
+                for (std::size_t k = 0; k < 2; ++k) {
+                    lo[k] = std::min(lo[k], b.lo[k]);
+                    hi[k] = std::max(hi[k], b.hi[k]);
+                }
+                extent += std::max(b.hi[0] - b.lo[0], b.hi[1] - b.lo[1]);
+            }
+
+            const double n = double(lines.size());
+            const double w = hi[0] - lo[0], h = hi[1] - lo[1];
+            double cell = _requested > 0.0 ? _requested : 2.0 * extent / n;
+            if (!(cell > 0.0))
+                cell = std::max({w, h, 1.0});
+
+            const double maxCells = 4.0 * n + 16.0;
+            while ((std::floor(w / cell) + 1.0) * (std::floor(h / cell) + 1.0) > maxCells)
+                cell *= 1.5;
+
+            _cell = cell;
+            _inv = 1.0 / cell;
+            _ox = lo[0];
+            _oy = lo[1];
+            _nx = std::size_t(w * _inv) + 1;
+            _ny = std::size_t(h * _inv) + 1;
+        }
+
+        /*
+         * Calls visit(cell) for every cell the segment may cross. In cell units, the row band
+         * [r, r + 1] clips the segment to an x interval, computed by interpolation and padded
+         * so that rounding can only add cells, never drop one.
+         */
+        template <typename Visit>
+        void cover(const Line<T>& line, Visit&& visit) const {
+            constexpr double pad = 1e-6;
+            const double x1 = (double(line.p1.x) - _ox) * _inv, y1 = (double(line.p1.y) - _oy) * _inv;
+            const double x2 = (double(line.p2.x) - _ox) * _inv, y2 = (double(line.p2.y) - _oy) * _inv;
+            const double xmin = std::min(x1, x2), xmax = std::max(x1, x2);
+            const double ymin = std::min(y1, y2), ymax = std::max(y1, y2);
+            const double slope = y1 != y2 ? (x2 - x1) / (y2 - y1) : 0.0;
+
+            auto clampCell = [](double v, std::size_t count) {
+                return v <= 0.0 ? std::size_t(0) : std::min(std::size_t(v), count - 1);
+            };
+            const std::size_t r0 = clampCell(std::floor(ymin - pad), _ny);
+            const std::size_t r1 = clampCell(std::floor(ymax + pad), _ny);
+            for (std::size_t r = r0; r <= r1; ++r) {
+                double a = xmin, b = xmax;
+                if (y1 != y2) {
+                    const double ya = std::max(ymin, double(r)), yb = std::min(ymax, double(r + 1));
+                    const double xa = x1 + (ya - y1) * slope, xb = x1 + (yb - y1) * slope;
+                    a = std::max(xmin, std::min(xa, xb));
+                    b = std::min(xmax, std::max(xa, xb));
+                }
+                const std::size_t c0 = clampCell(std::floor(a - pad), _nx);
+                const std::size_t c1 = clampCell(std::floor(b + pad), _nx);
+                for (std::size_t c = c0; c <= c1; ++c)
+                    visit(r * _nx + c);
+            }
+        }
+
+        void fillCells(std::span<const Line<T>> lines) {
+            const std::size_t cells = _nx * _ny;
+            _cellStart.assign(cells + 1, 0);
+            for (std::size_t i = 0; i < lines.size(); ++i)
+                cover(lines[i], [&](std::size_t c) { ++_cellStart[c + 1]; });
+            for (std::size_t c = 0; c < cells; ++c)
+                _cellStart[c + 1] += _cellStart[c];
+
+            _entries.resize(_cellStart[cells]);
+            _next.assign(_cellStart.begin(), _cellStart.end() - 1);
+            for (std::size_t i = 0; i < lines.size(); ++i)
+                cover(lines[i], [&](std::size_t c) { _entries[_next[c]++] = Index(i); });
+        }
+
+        double _requested;
+        double _cell = 1.0, _inv = 1.0;
+        double _ox = 0.0, _oy = 0.0;
+        std::size_t _nx = 0, _ny = 0;
+        std::vector<Box> _boxes;
+        std::vector<std::size_t> _cellStart;
+        std::vector<std::size_t> _next;
+        std::vector<Index> _entries;
+        std::vector<Pair> _pairs;
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class SegmentIntersector<double>;
+#endif
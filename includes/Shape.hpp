@@ -9,6 +9,17 @@
 
 #include "Vector2.hpp"
 #include "Constants.hpp"
+#include "Predicates.hpp"
+
+namespace shape_detail {
+
+    // Lexicographic (x, then y) order used by the canonical forms.
+    template <typename T>
+    bool before(const Vector2<T>& a, const Vector2<T>& b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    }
+
+} // namespace shape_detail
 
 // Rectangle
 template <typename T>
@@ -19,8 +30,7 @@ struct Rect {
     Vector2<T> half()   const { return {w / T(2), h / T(2)}; }
 
     // AABB overlap with optional margin.
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    bool intersects(const Rect& o, T margin = T(0)) const {
+    bool intersects(const Rect& o, T margin = T(0)) const requires std::is_arithmetic<T>::value {
         return !(x + w / T(2) + margin < o.x - o.w / T(2) ||
                  x - w / T(2) - margin > o.x + o.w / T(2) ||
                  y + h / T(2) + margin < o.y - o.h / T(2) ||
@@ -37,18 +47,40 @@ template <typename T>
 struct Line {
     Vector2<T> p1, p2;
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    bool operator==(const Line& other) const {
+    bool operator==(const Line& other) const requires std::is_arithmetic<T>::value {
         // Edges are undirected: (p1,p2) == (p2,p1)
         return (p1 == other.p1 && p2 == other.p2) ||
                 (p1 == other.p2 && p2 == other.p1);
     }
 
-    bool same(const Line& other) const {
+    bool same(const Line& other) const requires std::is_floating_point<T>::value {
         // Edges are undirected: (p1,p2) == (p2,p1)
         return (p1.same(other.p1) && p2.same(other.p2)) ||
                 (p1.same(other.p2) && p2.same(other.p1));
     }
+
+    // Endpoints in (x, y) order: a == b exactly when a.canonical() and b.canonical() match member-wise.
+    Line canonical() const requires std::is_arithmetic<T>::value { return shape_detail::before(p2, p1) ? Line{p2, p1} : *this; }
+
+    // Closed segments: touching endpoints and collinear overlaps count (exact, see Predicates.hpp).
+    bool intersects(const Line& other) const requires std::is_arithmetic<T>::value {
+        const double d1 = orient2d(other.p1, other.p2, p1);
+        const double d2 = orient2d(other.p1, other.p2, p2);
+        const double d3 = orient2d(p1, p2, other.p1);
+        const double d4 = orient2d(p1, p2, other.p2);
+
+        if (((d1 > 0.0 && d2 < 0.0) || (d1 < 0.0 && d2 > 0.0)) &&
+            ((d3 > 0.0 && d4 < 0.0) || (d3 < 0.0 && d4 > 0.0)))
+            return true;
+
+        // p is collinear with (a, b): on the segment when inside its bounding box
+        auto within = [](const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& p) {
+            return std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+                   std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+        };
+        return (d1 == 0.0 && within(other.p1, other.p2, p1)) || (d2 == 0.0 && within(other.p1, other.p2, p2)) ||
+               (d3 == 0.0 && within(p1, p2, other.p1)) || (d4 == 0.0 && within(p1, p2, other.p2));
+    }
 };
 
 using Lineu = Line<std::uint32_t>;
@@ -60,49 +92,40 @@ template <typename T>
 struct Triangle {
     Vector2<T> p1, p2, p3;
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    bool isInsideCircumcircle(const Vector2<T>& p) {
-        //p become the origin (0,0)
-        Vector2<T> a = {p1.x - p.x, p1.y - p.y};
-        Vector2<T> b = {p2.x - p.x, p2.y - p.y};
-        Vector2<T> c = {p3.x - p.x, p3.y - p.y};
-
-        //geometric condition (squared distances from P to each vertex)
-        T a2 = a.square_magnitude(); // ||p1'||^2
-        T b2 = b.square_magnitude(); // ||p2'||^2
-        T c2 = c.square_magnitude(); // ||p3'||^2
-
-        T term1 = a.x * (b.y * c2 - c.y * b2); // contribution de la coordonnée x de A
-        T term2 = - a.y * (b.x * c2 - c.x * b2); // contribution de la coordonnée y de A
-        T term3 = a2 * b.cross(c); // contribution de la distance au carré de A (z) combinée à B et C // B' × C'
-        T det = term1 + term2 + term3; // La somme (det) nous dit si P est au-dessus ou en dessous du plan → donc à l’intérieur ou à l’extérieur du cercle.
-
-        return (det < Epsilon<T>::value);
+    // Strictly inside the circumcircle, for both windings (exact, see Predicates.hpp).
+    bool isInsideCircumcircle(const Vector2<T>& p) const requires std::is_arithmetic<T>::value {
+        const double winding = orient2d(p1, p2, p3);
+        const double det = incircle(p1, p2, p3, p);
+        return winding > 0.0 ? det > 0.0 : winding < 0.0 && det < 0.0;
     }
 
+    // Inside or on the border, for both windings (exact, see Predicates.hpp).
+    bool isInside(Vector2<T> P) const {
+        const double d1 = orient2d(p1, p2, P);
+        const double d2 = orient2d(p2, p3, P);
+        const double d3 = orient2d(p3, p1, P);
 
-    bool isInside(Vector2<T> P) {
-        const double abc = 0.5 * abs(p1.x * (p2.y - p3.y) + p2.x * (p3.y - p1.y) + p3.x * (p1.y - p2.y));
-
-        const double abp = 0.5 * abs(p1.x * (p2.y - P.y) + p2.x * (P.y - p1.y) + P.x * (p1.y - p2.y));
-        const double bcp = 0.5 * abs(p2.x * (p3.y - P.y) + p3.x * (P.y - p2.y) + P.x * (p2.y - p3.y));
-        const double cap = 0.5 * abs(p3.x * (p1.y - P.y) + p1.x * (P.y - p3.y) + P.x * (p3.y - p1.y));
+        const bool negative = d1 < 0.0 || d2 < 0.0 || d3 < 0.0;
+        const bool positive = d1 > 0.0 || d2 > 0.0 || d3 > 0.0;
+        return !(negative && positive);
+    }
 
-        //if sum of abp, bcp, cap is equal to abc, then the point is inside the triangle, otherwise it's outside.
-        return std::abs(abc - (abp + bcp + cap)) < Epsilon<T>::value;
+    // Vertices in (x, y) order. The winding is not kept, only the vertex set.
+    Triangle canonical() const requires std::is_arithmetic<T>::value {
+        Triangle t = *this;
+        if (shape_detail::before(t.p2, t.p1)) std::swap(t.p1, t.p2);
+        if (shape_detail::before(t.p3, t.p2)) std::swap(t.p2, t.p3);
+        if (shape_detail::before(t.p2, t.p1)) std::swap(t.p1, t.p2);
+        return t;
     }
 
-    bool operator==(const Triangle<T>& other) const {
-        // Edges are undirected: (A,B,C) == any permutation of (A,B,C)
-        return ((p1 == other.p1) && (p2 == other.p2) && (p3 == other.p3)) ||
-            ((p1 == other.p1) && (p2 == other.p3) && (p3 == other.p2)) ||
-            ((p1 == other.p2) && (p2 == other.p1) && (p3 == other.p3)) ||
-            ((p1 == other.p2) && (p2 == other.p3) && (p3 == other.p1)) ||
-            ((p1 == other.p3) && (p2 == other.p1) && (p3 == other.p2)) ||
-            ((p1 == other.p3) && (p2 == other.p2) && (p3 == other.p1));
+    bool operator==(const Triangle<T>& other) const requires std::is_arithmetic<T>::value {
+        // Edges are undirected: (A,B,C) == any permutation of (A,B,C), i.e. same sorted vertices
+        const Triangle a = canonical(), b = other.canonical();
+        return a.p1 == b.p1 && a.p2 == b.p2 && a.p3 == b.p3;
     }
 
-    bool same(const Triangle<T>& other) const {
+    bool same(const Triangle<T>& other) const requires std::is_floating_point<T>::value {
         
         // Edges are undirected: (A,B) == (B,A)
         return (p1.same(other.p1) && p2.same(other.p2) && p3.same(other.p3)) ||
@@ -118,3 +141,34 @@ struct Triangle {
 using Triangleu = Triangle<std::uint32_t>;
 using Trianglei = Triangle<std::int32_t>;
 using Trianglef = Triangle<double>;
+
+// ---------- Hash ----------
+// Independent of the vertex order, like operator==.
+template <typename T>
+struct std::hash<Line<T>> {
+    std::size_t operator()(const Line<T>& l) const {
+        const std::hash<Vector2<T>> h;
+        return std::size_t(hashing::unordered(h(l.p1), h(l.p2)));
+    }
+};
+
+template <typename T>
+struct std::hash<Triangle<T>> {
+    std::size_t operator()(const Triangle<T>& t) const {
+        const std::hash<Vector2<T>> h;
+        return std::size_t(hashing::unordered(h(t.p1), h(t.p2), h(t.p3)));
+    }
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template struct Rect<std::uint32_t>;
+extern template struct Rect<std::int32_t>;
+extern template struct Rect<double>;
+extern template struct Line<std::uint32_t>;
+extern template struct Line<std::int32_t>;
+extern template struct Line<double>;
+extern template struct Triangle<std::uint32_t>;
+extern template struct Triangle<std::int32_t>;
+extern template struct Triangle<double>;
+#endif
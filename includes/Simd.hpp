@@ -0,0 +1,403 @@
+/**
+ * @file Simd.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Thin SIMD pack abstraction (AVX / SSE2 / scalar) used by the batch kernels
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+// ---------- Instruction set selection ----------
+// Define SYSTEM_NO_SIMD to force the scalar fallback (useful to test the reference path).
+#if !defined(SYSTEM_NO_SIMD) && defined(__AVX__)
+    #define SYSTEM_SIMD_AVX 1
+    #include <immintrin.h>
+#elif !defined(SYSTEM_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+    #define SYSTEM_SIMD_SSE 1
+    #include <emmintrin.h>
+#endif
+
+namespace simd {
+
+    // Alignment used for every SIMD friendly buffer (one AVX register).
+    constexpr std::size_t alignment = 32;
+
+    // ---------- Aligned allocator ----------
+    template <typename T, std::size_t Align = alignment>
+    struct aligned_allocator {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind { using other = aligned_allocator<U, Align>; };
+
+        aligned_allocator() = default;
+
+        template <typename U>
+        aligned_allocator(const aligned_allocator<U, Align>&) {}
+
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+        }
+
+        void deallocate(T* p, std::size_t) {
+            ::operator delete(p, std::align_val_t(Align));
+        }
+
+        template <typename U>
+        bool operator==(const aligned_allocator<U, Align>&) const { return true; }
+
+        template <typename U>
+        bool operator!=(const aligned_allocator<U, Align>&) const { return false; }
+    };
+
+    // ---------- Scalar fallback (width 1) ----------
+    // `pack<T, true>` is always the scalar version, it is also used to finish loop tails.
+    // pack::bits(mask) packs a mask into an integer, bit i is set when lane i is true.
+    // pack::loadBytes / storeBytes convert `width` uint8 to lanes and back (storeBytes rounds to
+    // nearest even and saturates to [0, 255], lanes outside the int32 range or NaN need a clamp
+    // first), used by the pixel kernels.
+    // pack::shuffle4<I0, I1, I2, I3> permutes every group of 4 lanes (lane j takes lane Ij of its
+    // group), only defined for packs whose width is a multiple of 4.
+    template <typename T, bool Scalar = false>
+    struct pack {
+        using value_type = T;
+        using mask_type = bool;
+        static constexpr std::size_t width = 1;
+
+        T v;
+
+        static pack load(const T* p) { return {*p}; }
+        static pack broadcast(T x) { return {x}; }
+        void store(T* p) const { *p = v; }
+
+        static pack loadBytes(const std::uint8_t* p) { return {T(*p)}; }
+        void storeBytes(std::uint8_t* p) const {
+            T x = v;
+            if constexpr (std::is_floating_point<T>::value)
+                x = std::nearbyint(x);
+            *p = std::uint8_t(!(x > T(0)) ? T(0) : x > T(255) ? T(255) : x); // NaN -> 0
+        }
+
+        friend pack operator+(pack a, pack b) { return {T(a.v + b.v)}; }
+        friend pack operator-(pack a, pack b) { return {T(a.v - b.v)}; }
+        friend pack operator*(pack a, pack b) { return {T(a.v * b.v)}; }
+        friend pack operator/(pack a, pack b) { return {T(a.v / b.v)}; }
+        friend pack operator>>(pack a, int shift) { return {T(a.v >> shift)}; }
+
+        friend pack sqrt(pack a) { return {T(std::sqrt(a.v))}; }
+        friend pack min(pack a, pack b) { return {a.v < b.v ? a.v : b.v}; }
+        friend pack max(pack a, pack b) { return {a.v > b.v ? a.v : b.v}; }
+
+        friend mask_type lt(pack a, pack b) { return a.v < b.v; }
+        friend mask_type gt(pack a, pack b) { return a.v > b.v; }
+        friend pack select(mask_type m, pack a, pack b) { return m ? a : b; }
+        static unsigned bits(mask_type m) { return m ? 1u : 0u; }
+    };
+
+#if defined(SYSTEM_SIMD_AVX)
+
+    template <>
+    struct pack<float, false> {
+        using value_type = float;
+        using mask_type = __m256;
+        static constexpr std::size_t width = 8;
+
+        __m256 v;
+
+        static pack load(const float* p) { return {_mm256_loadu_ps(p)}; }
+        static pack broadcast(float x) { return {_mm256_set1_ps(x)}; }
+        void store(float* p) const { _mm256_storeu_ps(p, v); }
+
+        // AVX implies SSE4.1, the byte widening is done on 128-bit halves (no AVX2 needed)
+        static pack loadBytes(const std::uint8_t* p) {
+            std::int32_t lo, hi;
+            std::memcpy(&lo, p, 4);
+            std::memcpy(&hi, p + 4, 4);
+            const __m128i a = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(lo));
+            const __m128i b = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(hi));
+            return {_mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(a), b, 1))};
+        }
+        void storeBytes(std::uint8_t* p) const {
+            const __m256i i = _mm256_cvtps_epi32(v);
+            const __m128i w = _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extractf128_si256(i, 1));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(w, w));
+        }
+
+        template <int I0, int I1, int I2, int I3>
+        static pack shuffle4(pack a) { return {_mm256_permute_ps(a.v, _MM_SHUFFLE(I3, I2, I1, I0))}; }
+
+        friend pack operator+(pack a, pack b) { return {_mm256_add_ps(a.v, b.v)}; }
+        friend pack operator-(pack a, pack b) { return {_mm256_sub_ps(a.v, b.v)}; }
+        friend pack operator*(pack a, pack b) { return {_mm256_mul_ps(a.v, b.v)}; }
+        friend pack operator/(pack a, pack b) { return {_mm256_div_ps(a.v, b.v)}; }
+
+        friend pack sqrt(pack a) { return {_mm256_sqrt_ps(a.v)}; }
+        friend pack min(pack a, pack b) { return {_mm256_min_ps(a.v, b.v)}; }
+        friend pack max(pack a, pack b) { return {_mm256_max_ps(a.v, b.v)}; }
+
+        friend mask_type lt(pack a, pack b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+        friend mask_type gt(pack a, pack b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+        friend pack select(mask_type m, pack a, pack b) { return {_mm256_blendv_ps(b.v, a.v, m)}; }
+        static unsigned bits(mask_type m) { return unsigned(_mm256_movemask_ps(m)); }
+    };
+
+    template <>
+    struct pack<double, false> {
+        using value_type = double;
+        using mask_type = __m256d;
+        static constexpr std::size_t width = 4;
+
+        __m256d v;
+
+        static pack load(const double* p) { return {_mm256_loadu_pd(p)}; }
+        static pack broadcast(double x) { return {_mm256_set1_pd(x)}; }
+        void store(double* p) const { _mm256_storeu_pd(p, v); }
+
+        friend pack operator+(pack a, pack b) { return {_mm256_add_pd(a.v, b.v)}; }
+        friend pack operator-(pack a, pack b) { return {_mm256_sub_pd(a.v, b.v)}; }
+        friend pack operator*(pack a, pack b) { return {_mm256_mul_pd(a.v, b.v)}; }
+        friend pack operator/(pack a, pack b) { return {_mm256_div_pd(a.v, b.v)}; }
+
+        friend pack sqrt(pack a) { return {_mm256_sqrt_pd(a.v)}; }
+        friend pack min(pack a, pack b) { return {_mm256_min_pd(a.v, b.v)}; }
+        friend pack max(pack a, pack b) { return {_mm256_max_pd(a.v, b.v)}; }
+
+        friend mask_type lt(pack a, pack b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+        friend mask_type gt(pack a, pack b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ); }
+        friend pack select(mask_type m, pack a, pack b) { return {_mm256_blendv_pd(b.v, a.v, m)}; }
+        static unsigned bits(mask_type m) { return unsigned(_mm256_movemask_pd(m)); }
+    };
+
+#elif defined(SYSTEM_SIMD_SSE)
+
+    template <>
+    struct pack<float, false> {
+        using value_type = float;
+        using mask_type = __m128;
+        static constexpr std::size_t width = 4;
+
+        __m128 v;
+
+        static pack load(const float* p) { return {_mm_loadu_ps(p)}; }
+        static pack broadcast(float x) { return {_mm_set1_ps(x)}; }
+        void store(float* p) const { _mm_storeu_ps(p, v); }
+
+        static pack loadBytes(const std::uint8_t* p) {
+            std::int32_t x;
+            std::memcpy(&x, p, 4);
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i b = _mm_unpacklo_epi8(_mm_cvtsi32_si128(x), zero);
+            return {_mm_cvtepi32_ps(_mm_unpacklo_epi16(b, zero))};
+        }
+        void storeBytes(std::uint8_t* p) const {
+            const __m128i i = _mm_cvtps_epi32(v);
+            const __m128i w = _mm_packs_epi32(i, i);
+            const std::int32_t x = _mm_cvtsi128_si32(_mm_packus_epi16(w, w));
+            std::memcpy(p, &x, 4);
+        }
+
+        template <int I0, int I1, int I2, int I3>
+        static pack shuffle4(pack a) { return {_mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(I3, I2, I1, I0))}; }
+
+        friend pack operator+(pack a, pack b) { return {_mm_add_ps(a.v, b.v)}; }
+        friend pack operator-(pack a, pack b) { return {_mm_sub_ps(a.v, b.v)}; }
+        friend pack operator*(pack a, pack b) { return {_mm_mul_ps(a.v, b.v)}; }
+        friend pack operator/(pack a, pack b) { return {_mm_div_ps(a.v, b.v)}; }
+
+        friend pack sqrt(pack a) { return {_mm_sqrt_ps(a.v)}; }
+        friend pack min(pack a, pack b) { return {_mm_min_ps(a.v, b.v)}; }
+        friend pack max(pack a, pack b) { return {_mm_max_ps(a.v, b.v)}; }
+
+        friend mask_type lt(pack a, pack b) { return _mm_cmplt_ps(a.v, b.v); }
+        friend mask_type gt(pack a, pack b) { return _mm_cmpgt_ps(a.v, b.v); }
+        friend pack select(mask_type m, pack a, pack b) {
+            return {_mm_or_ps(_mm_and_ps(m, a.v), _mm_andnot_ps(m, b.v))};
+        }
+        static unsigned bits(mask_type m) { return unsigned(_mm_movemask_ps(m)); }
+    };
+
+    template <>
+    struct pack<double, false> {
+        using value_type = double;
+        using mask_type = __m128d;
+        static constexpr std::size_t width = 2;
+
+        __m128d v;
+
+        static pack load(const double* p) { return {_mm_loadu_pd(p)}; }
+        static pack broadcast(double x) { return {_mm_set1_pd(x)}; }
+        void store(double* p) const { _mm_storeu_pd(p, v); }
+
+        friend pack operator+(pack a, pack b) { return {_mm_add_pd(a.v, b.v)}; }
+        friend pack operator-(pack a, pack b) { return {_mm_sub_pd(a.v, b.v)}; }
+        friend pack operator*(pack a, pack b) { return {_mm_mul_pd(a.v, b.v)}; }
+        friend pack operator/(pack a, pack b) { return {_mm_div_pd(a.v, b.v)}; }
+
+        friend pack sqrt(pack a) { return {_mm_sqrt_pd(a.v)}; }
+        friend pack min(pack a, pack b) { return {_mm_min_pd(a.v, b.v)}; }
+        friend pack max(pack a, pack b) { return {_mm_max_pd(a.v, b.v)}; }
+
+        friend mask_type lt(pack a, pack b) { return _mm_cmplt_pd(a.v, b.v); }
+        friend mask_type gt(pack a, pack b) { return _mm_cmpgt_pd(a.v, b.v); }
+        friend pack select(mask_type m, pack a, pack b) {
+            return {_mm_or_pd(_mm_and_pd(m, a.v), _mm_andnot_pd(m, b.v))};
+        }
+        static unsigned bits(mask_type m) { return unsigned(_mm_movemask_pd(m)); }
+    };
+
+#endif
+
+    // ---------- Integer packs ----------
+    // uint16 lanes: modular + - * (low 16 bits of the product) and logical >>, the width the
+    // pixel kernels use to hold 8-bit channels and their 16-bit products.
+#if defined(SYSTEM_SIMD_AVX) && defined(__AVX2__)
+
+    template <>
+    struct pack<std::uint16_t, false> {
+        using value_type = std::uint16_t;
+        static constexpr std::size_t width = 16;
+
+        __m256i v;
+
+        static pack load(const std::uint16_t* p) { return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))}; }
+        static pack broadcast(std::uint16_t x) { return {_mm256_set1_epi16(std::int16_t(x))}; }
+        void store(std::uint16_t* p) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+        static pack loadBytes(const std::uint8_t* p) {
+            return {_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)))};
+        }
+        void storeBytes(std::uint8_t* p) const {
+            // packus works per 128-bit half: keep the low quadword of each half
+            const __m256i b = _mm256_permute4x64_epi64(_mm256_packus_epi16(v, v), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(b));
+        }
+
+        friend pack operator+(pack a, pack b) { return {_mm256_add_epi16(a.v, b.v)}; }
+        friend pack operator-(pack a, pack b) { return {_mm256_sub_epi16(a.v, b.v)}; }
+        friend pack operator*(pack a, pack b) { return {_mm256_mullo_epi16(a.v, b.v)}; }
+        friend pack operator>>(pack a, int shift) { return {_mm256_srl_epi16(a.v, _mm_cvtsi32_si128(shift))}; }
+
+        friend pack min(pack a, pack b) { return {_mm256_min_epu16(a.v, b.v)}; }
+        friend pack max(pack a, pack b) { return {_mm256_max_epu16(a.v, b.v)}; }
+
+        template <int I0, int I1, int I2, int I3>
+        static pack shuffle4(pack a) {
+            constexpr int imm = _MM_SHUFFLE(I3, I2, I1, I0);
+            return {_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(a.v, imm), imm)};
+        }
+    };
+
+#elif defined(SYSTEM_SIMD_AVX) || defined(SYSTEM_SIMD_SSE)
+
+    template <>
+    struct pack<std::uint16_t, false> {
+        using value_type = std::uint16_t;
+        static constexpr std::size_t width = 8;
+
+        __m128i v;
+
+        static pack load(const std::uint16_t* p) { return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))}; }
+        static pack broadcast(std::uint16_t x) { return {_mm_set1_epi16(std::int16_t(x))}; }
+        void store(std::uint16_t* p) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+
+        static pack loadBytes(const std::uint8_t* p) {
+            return {_mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128())};
+        }
+        void storeBytes(std::uint8_t* p) const {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(v, v));
+        }
+
+        friend pack operator+(pack a, pack b) { return {_mm_add_epi16(a.v, b.v)}; }
+        friend pack operator-(pack a, pack b) { return {_mm_sub_epi16(a.v, b.v)}; }
+        friend pack operator*(pack a, pack b) { return {_mm_mullo_epi16(a.v, b.v)}; }
+        friend pack operator>>(pack a, int shift) { return {_mm_srl_epi16(a.v, _mm_cvtsi32_si128(shift))}; }
+
+        // SSE2 only compares signed 16-bit lanes: flip the sign bit around it
+        friend pack min(pack a, pack b) {
+            const __m128i bias = _mm_set1_epi16(std::int16_t(0x8000));
+            return {_mm_xor_si128(_mm_min_epi16(_mm_xor_si128(a.v, bias), _mm_xor_si128(b.v, bias)), bias)};
+        }
+        friend pack max(pack a, pack b) {
+            const __m128i bias = _mm_set1_epi16(std::int16_t(0x8000));
+            return {_mm_xor_si128(_mm_max_epi16(_mm_xor_si128(a.v, bias), _mm_xor_si128(b.v, bias)), bias)};
+        }
+
+        template <int I0, int I1, int I2, int I3>
+        static pack shuffle4(pack a) {
+            constexpr int imm = _MM_SHUFFLE(I3, I2, I1, I0);
+            return {_mm_shufflehi_epi16(_mm_shufflelo_epi16(a.v, imm), imm)};
+        }
+    };
+
+#endif
+
+    template <typename T>
+    using scalar = pack<T, true>;
+
+    // ---------- Approximations ----------
+    /**
+     * @brief acos(x) for x in [0, 1], Abramowitz & Stegun 4.4.46
+     *
+     * acos(x) = sqrt(1 - x) * (a0 + a1 x + ... + a7 x^7), |error| <= 2e-8 rad (plus rounding in T).
+     */
+    template <typename P>
+    P acos_unit(P x) {
+        using T = typename P::value_type;
+        P r = P::broadcast(T(-0.0012624911));
+        r = r * x + P::broadcast(T(0.0066700901));
+        r = r * x + P::broadcast(T(-0.0170881256));
+        r = r * x + P::broadcast(T(0.0308918810));
+        r = r * x + P::broadcast(T(-0.0501743046));
+        r = r * x + P::broadcast(T(0.0889789874));
+        r = r * x + P::broadcast(T(-0.2145988016));
+        r = r * x + P::broadcast(T(1.5707963050));
+        return sqrt(P::broadcast(T(1)) - x) * r;
+    }
+
+    /**
+     * @brief sin(x) for x in [0, pi/2], odd Taylor polynomial up to x^11
+     *
+     * |error| <= (pi/2)^13 / 13! < 6e-8 (plus rounding in T).
+     */
+    template <typename P>
+    P sin_half_pi(P x) {
+        using T = typename P::value_type;
+        P x2 = x * x;
+        P r = P::broadcast(T(-1.0 / 39916800.0));
+        r = r * x2 + P::broadcast(T(1.0 / 362880.0));
+        r = r * x2 + P::broadcast(T(-1.0 / 5040.0));
+        r = r * x2 + P::broadcast(T(1.0 / 120.0));
+        r = r * x2 + P::broadcast(T(-1.0 / 6.0));
+        r = r * x2 + P::broadcast(T(1));
+        return r * x;
+    }
+
+    /**
+     * @brief run `kernel(p, i)` over [0, n): full packs first, then the tail one lane at a time
+     *
+     * `kernel` is a generic lambda, `p` is only a tag whose type (pack<T> or scalar<T>)
+     * tells the body which width to load/store at index `i`.
+     */
+    template <typename T, typename Kernel>
+    void for_each(std::size_t n, Kernel&& kernel) {
+        using P = pack<T>;
+        std::size_t i = 0;
+
+        // an explicit bound for the pack loop, GCC cannot size the tail loop from `i + width <= n`
+        if constexpr (P::width > 1) {
+            const std::size_t packed = n - n % P::width;
+            for (; i < packed; i += P::width)
+                kernel(P{}, i);
+        }
+        for (; i < n; ++i)
+            kernel(scalar<T>{}, i);
+    }
+
+} // namespace simd
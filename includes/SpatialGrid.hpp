@@ -0,0 +1,299 @@
+/**
+ * @file SpatialGrid.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Uniform grid index over Vector2 points: radius and k-nearest queries
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "ThreadPool.hpp"
+#include "Vector2.hpp"
+
+/**
+ * @brief uniform grid over the bounding box of a point set
+ *
+ * Points are bucketed by cell with a counting sort: one prefix-summed `cellStart` array and
+ * the points copied in cell order, so scanning a cell reads contiguous memory and there is no
+ * per-cell allocation. Every query compares squared distances (square_magnitude), no sqrt.
+ *
+ * The cell size is given at construction, 0 picks one from the data (about two points per
+ * cell). It is grown when the bounding box would need more than ~4 cells per point.
+ * Rebuilds above `parallelThreshold` points split the counting sort across threads.
+ */
+template <typename T>
+class SpatialGrid {
+    static_assert(std::is_arithmetic<T>::value && std::is_signed<T>::value,
+                  "SpatialGrid needs a signed coordinate type (p - center must not wrap)");
+
+    public:
+        using Index = std::uint32_t;
+
+        struct Neighbor {
+            Index id;
+            T distance2;    // squared distance to the query point
+        };
+
+        static constexpr std::size_t parallelThreshold = 100000;
+
+        explicit SpatialGrid(T cellSize = T(0)) : _requested(double(cellSize)) {}
+
+        std::size_t size() const { return _points.size(); }
+        bool empty() const { return _points.empty(); }
+        double cellSize() const { return _cell; }
+        std::size_t columns() const { return _nx; }
+        std::size_t rows() const { return _ny; }
+
+        /**
+         * @brief replaces the indexed points, ids are positions in `points`
+         * @param threads 0 = hardware concurrency when points.size() >= parallelThreshold, 1 otherwise
+         */
+        void rebuild(std::span<const Vector2<T>> points, unsigned threads = 0) {
+            const std::size_t n = points.size();
+            threads = parallel_detail::resolveThreads(threads, n, parallelThreshold);
+
+            layout(points, threads);
+
+            // cell of each point + one histogram per thread
+            _cellOf.resize(n);
+            auto& counts = _counts;
+            counts.resize(threads);
+            for (auto& count : counts)
+                count.assign(cells(), 0);
+            parallel(threads, n, [&](unsigned t, std::size_t begin, std::size_t end) {
+                Index* count = counts[t].data();
+                for (std::size_t i = begin; i < end; ++i) {
+                    const Index c = Index(cellIndex(points[i]));
+                    _cellOf[i] = c;
+                    ++count[c];
+                }
+            });
+
+            // exclusive prefix, cell major then thread: each thread scatters into its own slots,
+            // which keeps the output identical to the serial (stable) sort
+            _cellStart.assign(cells() + 1, 0);
+            Index offset = 0;
+            for (std::size_t c = 0; c < cells(); ++c) {
+                _cellStart[c] = offset;
+                for (unsigned t = 0; t < threads; ++t) {
+                    const Index count = counts[t][c];
+                    counts[t][c] = offset;
+                    offset += count;
+                }
+            }
+            _cellStart[cells()] = offset;
+
+            _points.resize(n);
+            _ids.resize(n);
+            parallel(threads, n, [&](unsigned t, std::size_t begin, std::size_t end) {
+                Index* next = counts[t].data();
+                for (std::size_t i = begin; i < end; ++i) {
+                    const Index slot = next[_cellOf[i]]++;
+                    _points[slot] = points[i];
+                    _ids[slot] = Index(i);
+                }
+            });
+        }
+
+        /**
+         * @brief calls visit(id, distance2) for every point with |p - center| <= radius
+         */
+        template <typename F>
+        void query(const Vector2<T>& center, T radius, F&& visit) const {
+            if (_points.empty() || radius < T(0))
+                return;
+
+            const T r2 = radius * radius;
+            const double r = double(radius);
+            std::size_t x0, x1, y0, y1;
+            if (!cellRange(double(center.x) - r, double(center.x) + r, _ox, _nx, x0, x1)
+             || !cellRange(double(center.y) - r, double(center.y) + r, _oy, _ny, y0, y1))
+                return;
+
+            for (std::size_t y = y0; y <= y1; ++y) {
+                // cells of a row are consecutive, so is their storage
+                const std::size_t begin = _cellStart[y * _nx + x0], end = _cellStart[y * _nx + x1 + 1];
+                for (std::size_t i = begin; i < end; ++i) {
+                    const T d2 = (_points[i] - center).square_magnitude();
+                    if (d2 <= r2)
+                        visit(_ids[i], d2);
+                }
+            }
+        }
+
+        // Appends the ids within `radius` of `center` to `out`, in no particular order.
+        void radius(const Vector2<T>& center, T radius, std::vector<Index>& out) const {
+            query(center, radius, [&](Index id, T) { out.push_back(id); });
+        }
+
+        /**
+         * @brief the k points closest to `center`, sorted by distance (ties by id)
+         *
+         * Cells are scanned in square rings around the cell of `center`; the search stops once
+         * k candidates are known and the closest unscanned cell is farther than the k-th.
+         * `out` is the working heap, reusing it across calls avoids allocations.
+         */
+        void nearest(const Vector2<T>& center, std::size_t k, std::vector<Neighbor>& out) const {
+            out.clear();
+            k = std::min(k, _points.size());
+            if (k == 0)
+                return;
+
+            auto closer = [](const Neighbor& a, const Neighbor& b) {
+                return a.distance2 < b.distance2 || (a.distance2 == b.distance2 && a.id < b.id);
+            };
+            auto consider = [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    const Neighbor candidate{_ids[i], (_points[i] - center).square_magnitude()};
+                    if (out.size() < k) {
+                        out.push_back(candidate);
+                        std::push_heap(out.begin(), out.end(), closer);
+                    } else if (closer(candidate, out.front())) {
+                        std::pop_heap(out.begin(), out.end(), closer);
+                        out.back() = candidate;
+                        std::push_heap(out.begin(), out.end(), closer);
+                    }
+                }
+            };
+            auto scanRow = [&](std::ptrdiff_t y, std::ptrdiff_t xa, std::ptrdiff_t xb) {
+                if (y < 0 || y >= std::ptrdiff_t(_ny))
+                    return;
+                xa = std::max<std::ptrdiff_t>(xa, 0);
+                xb = std::min<std::ptrdiff_t>(xb, std::ptrdiff_t(_nx) - 1);
+                if (xa <= xb)
+                    consider(_cellStart[std::size_t(y) * _nx + std::size_t(xa)],
+                             _cellStart[std::size_t(y) * _nx + std::size_t(xb) + 1]);
+            };
+            auto scanColumn = [&](std::ptrdiff_t x, std::ptrdiff_t ya, std::ptrdiff_t yb) {
+                if (x < 0 || x >= std::ptrdiff_t(_nx))
+                    return;
+                ya = std::max<std::ptrdiff_t>(ya, 0);
+                yb = std::min<std::ptrdiff_t>(yb, std::ptrdiff_t(_ny) - 1);
+                for (std::ptrdiff_t y = ya; y <= yb; ++y) {
+                    const std::size_t c = std::size_t(y) * _nx + std::size_t(x);
+                    consider(_cellStart[c], _cellStart[c + 1]);
+                }
+            };
+
+            // the query cell, possibly outside the grid
+            const double fx = (double(center.x) - _ox) * _inv, fy = (double(center.y) - _oy) * _inv;
+            const std::ptrdiff_t cx = std::ptrdiff_t(std::floor(fx)), cy = std::ptrdiff_t(std::floor(fy));
+            const std::ptrdiff_t last = std::max({cx, std::ptrdiff_t(_nx) - 1 - cx, cy, std::ptrdiff_t(_ny) - 1 - cy,
+                                                  -cx, -cy});
+
+            for (std::ptrdiff_t ring = 0; ring <= last; ++ring) {
+                if (ring == 0) {
+                    scanRow(cy, cx, cx);
+                } else {
+                    scanRow(cy - ring, cx - ring, cx + ring);
+                    scanRow(cy + ring, cx - ring, cx + ring);
+                    scanColumn(cx - ring, cy - ring + 1, cy + ring - 1);
+                    scanColumn(cx + ring, cy - ring + 1, cy + ring - 1);
+                }
+
+                if (out.size() == k) {
+                    // every unscanned point lies outside the block of scanned cells, the slack
+                    // covers the rounding of the cell coordinates
+                    const double gap = std::min({fx - double(cx - ring), double(cx + ring + 1) - fx,
+                                                 fy - double(cy - ring), double(cy + ring + 1) - fy}) * _cell;
+                    if (gap * gap * (1.0 - 1e-9) > double(out.front().distance2))
+                        break;
+                }
+            }
+            std::sort_heap(out.begin(), out.end(), closer);
+        }
+
+    private:
+        std::size_t cells() const { return _nx * _ny; }
+
+        void layout(std::span<const Vector2<T>> points, unsigned threads) {
+            double lo[2] = {0.0, 0.0}, hi[2] = {0.0, 0.0};
+            if (!points.empty()) {
+                std::vector<double> box(std::size_t(threads) * 4);
+                parallel(threads, points.size(), [&](unsigned t, std::size_t begin, std::size_t end) {
+                    double* b = &box[std::size_t(t) * 4];
+                    b[0] = b[2] = double(points[begin].x);
+                    b[1] = b[3] = double(points[begin].y);
+                    for (std::size_t i = begin + 1; i < end; ++i) {
+                        const double x = double(points[i].x), y = double(points[i].y);
+                        b[0] = std::min(b[0], x); b[2] = std::max(b[2], x);
+                        b[1] = std::min(b[1], y); b[3] = std::max(b[3], y);
+                    }
+                });
+                lo[0] = hi[0] = box[0];
+                lo[1] = hi[1] = box[1];
+                for (unsigned t = 0; t < threads; ++t) {
+                    const double* b = &box[std::size_t(t) * 4];
+                    lo[0] = std::min(lo[0], b[0]); hi[0] = std::max(hi[0], b[2]);
+                    lo[1] = std::min(lo[1], b[1]); hi[1] = std::max(hi[1], b[3]);
+                }
+            }
+
+            const double w = hi[0] - lo[0], h = hi[1] - lo[1];
+            const double n = double(std::max<std::size_t>(points.size(), 1));
+            double cell = _requested > 0.0 ? _requested : std::sqrt(std::max(w * h, w * w / n + h * h / n) * 2.0 / n);
+            if (!(cell > 0.0))
+                cell = 1.0;
+
+            // at most ~4 cells per point, whatever the requested size
+            const double maxCells = 4.0 * n + 16.0;
+            while ((std::floor(w / cell) + 1.0) * (std::floor(h / cell) + 1.0) > maxCells)
+                cell *= 1.5;
+
+            _cell = cell;
+            _inv = 1.0 / cell;
+            _ox = lo[0];
+            _oy = lo[1];
+            _nx = std::size_t(w * _inv) + 1;
+            _ny = std::size_t(h * _inv) + 1;
+        }
+
+        std::size_t cellIndex(const Vector2<T>& p) const {
+            const std::size_t x = std::min(std::size_t((double(p.x) - _ox) * _inv), _nx - 1);
+            const std::size_t y = std::min(std::size_t((double(p.y) - _oy) * _inv), _ny - 1);
+            return y * _nx + x;
+        }
+
+        // Cells [first, last] overlapping [lo, hi] along one axis, false when none does.
+        bool cellRange(double lo, double hi, double origin, std::size_t count, std::size_t& first, std::size_t& last) const {
+            const double a = std::floor((lo - origin) * _inv), b = std::floor((hi - origin) * _inv);
+            if (b < 0.0 || a >= double(count))
+                return false;
+            first = a < 0.0 ? 0 : std::size_t(a);
+            last = b >= double(count) ? count - 1 : std::size_t(b);
+            return true;
+        }
+
+        // Runs fn(t, begin, end) over `threads` contiguous chunks of [0, n) on the thread pool. The
+        // split is fixed (chunk t always covers the same points): the per chunk histograms rely on it.
+        template <typename F>
+        static void parallel(unsigned threads, std::size_t n, F&& fn) {
+            parallel_for(0, threads, [&](std::size_t first, std::size_t last) {
+                for (std::size_t t = first; t < last; ++t)
+                    fn(unsigned(t), n * t / threads, n * (t + 1) / threads);
+            }, threads, 1);
+        }
+
+        double _requested;
+        double _cell = 1.0, _inv = 1.0;
+        double _ox = 0.0, _oy = 0.0;
+        std::size_t _nx = 0, _ny = 0;
+        std::vector<Index> _cellStart;
+        std::vector<Index> _cellOf;                 // rebuild scratch
+        std::vector<std::vector<Index>> _counts;    // rebuild scratch, one histogram per thread
+        std::vector<Vector2<T>> _points;
+        std::vector<Index> _ids;
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class SpatialGrid<double>;
+#endif
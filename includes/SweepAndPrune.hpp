@@ -0,0 +1,224 @@
+/**
+ * @file SweepAndPrune.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Sort-and-sweep broad phase over Rect collections
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Shape.hpp"
+#include "Simd.hpp"
+
+/**
+ * @brief finds every pair (a, b), a < b, with rects[a].intersects(rects[b], margin)
+ *
+ * Rects are swept along the axis where their centres have the highest variance.
+ * The sorted order is kept between calls: when the same collection is updated every frame,
+ * a single insertion sort pass restores it in close to O(n). The order is rebuilt from
+ * scratch when the size or the sweep axis changes.
+ *
+ * After sorting, the bounds are copied into SoA lanes and each rect is tested against the
+ * following ones one SIMD pack at a time. The final test evaluates exactly the expression of
+ * Rect::intersects (same rounding), so the result is identical to the O(n^2) loop.
+ * Pairs are returned in no particular order, the buffer is reused by the next update().
+ */
+template <typename T>
+class SweepAndPrune {
+    static_assert(std::is_arithmetic<T>::value && std::is_signed<T>::value,
+                  "SweepAndPrune needs a signed coordinate type (x - w / 2 must not wrap)");
+
+    public:
+        using Index = std::uint32_t;
+        using Pair = std::pair<Index, Index>;
+
+        explicit SweepAndPrune(T margin = T(0)) : _margin(margin) {}
+
+        T margin() const { return _margin; }
+        void setMargin(T margin) { _margin = margin; }
+
+        // Axis currently swept, 0 = x, 1 = y.
+        std::size_t axis() const { return _axis; }
+
+        const std::vector<Pair>& pairs() const { return _pairs; }
+
+        const std::vector<Pair>& update(std::span<const Rect<T>> rects) {
+            const std::size_t axis = varianceAxis(rects);
+
+            if (rects.size() != _order.size() || axis != _axis) {
+                _axis = axis;
+                rebuild(rects);
+            } else {
+                for (Key& key : _order)
+                    key.lo = bounds(rects[key.id], _axis).first;
+                insertionSort();
+            }
+            fillLanes(rects);
+            sweep();
+            return _pairs;
+        }
+
+    private:
+        struct Key {
+            T lo;       // lower bound along the sweep axis
+            Index id;
+        };
+
+        // Bounds in sweep order, axis 0 is the sweep axis. `LoM` = lo - margin, `HiP` = hi + margin.
+        enum Lane { Lo0, LoM0, Hi0, HiP0, Lo1, LoM1, Hi1, HiP1, LaneCount };
+
+        // (lo, hi) along `axis`, the expressions of Rect::intersects.
+        static std::pair<T, T> bounds(const Rect<T>& r, std::size_t axis) {
+            return axis == 0 ? std::pair<T, T>{r.x - r.w / T(2), r.x + r.w / T(2)}
+                             : std::pair<T, T>{r.y - r.h / T(2), r.y + r.h / T(2)};
+        }
+
+        static std::size_t varianceAxis(std::span<const Rect<T>> rects) {
+            if (rects.empty())
+                return 0;
+
+            double sx = 0.0, sy = 0.0, sxx = 0.0, syy = 0.0;
+            for (const auto& r : rects) {
+                const double x = double(r.x), y = double(r.y);
+                sx += x;
+                sy += y;
+                sxx += x * x;
+                syy += y * y;
+            }
+            const double n = double(rects.size());
+            const double vx = sxx - sx * sx / n;
+            const double vy = syy - sy * sy / n;
+            return vy > vx ? 1 : 0;
+        }
+
+        void rebuild(std::span<const Rect<T>> rects) {
+            _order.resize(rects.size());
+            for (std::size_t i = 0; i < rects.size(); ++i)
+                _order[i] = {bounds(rects[i], _axis).first, Index(i)};
+            std::sort(_order.begin(), _order.end(), [](const Key& a, const Key& b) { return a.lo < b.lo; });
+        }
+
+        // Nearly sorted input from the previous frame: O(n + swaps).
+        void insertionSort() {
+            for (std::size_t i = 1; i < _order.size(); ++i) {
+                if (!(_order[i].lo < _order[i - 1].lo))
+                    continue;
+
+                const Key moving = _order[i];
+                std::size_t j = i;
+                do {
+                    _order[j] = _order[j - 1];
+                    --j;
+                } while (j > 0 && moving.lo < _order[j - 1].lo);
+                _order[j] = moving;
+            }
+        }
+
+        void fillLanes(std::span<const Rect<T>> rects) {
+            const std::size_t n = _order.size();
+            for (auto& lane : _lanes)
+                lane.resize(n);
+            _ids.resize(n);
+
+            const T m = _margin;
+            for (std::size_t i = 0; i < n; ++i) {
+                const Rect<T>& r = rects[_order[i].id];
+                const auto [lo0, hi0] = bounds(r, _axis);
+                const auto [lo1, hi1] = bounds(r, 1 - _axis);
+
+                _lanes[Lo0][i] = lo0;
+                _lanes[LoM0][i] = lo0 - m;
+                _lanes[Hi0][i] = hi0;
+                _lanes[HiP0][i] = hi0 + m;
+                _lanes[Lo1][i] = lo1;
+                _lanes[LoM1][i] = lo1 - m;
+                _lanes[Hi1][i] = hi1;
+                _lanes[HiP1][i] = hi1 + m;
+                _ids[i] = _order[i].id;
+            }
+        }
+
+        // Rect::intersects with `a` (sweep position) being the rect with the lower index.
+        bool separated(std::size_t a, std::size_t b) const {
+            return _lanes[HiP0][a] < _lanes[Lo0][b] || _lanes[LoM0][a] > _lanes[Hi0][b] ||
+                   _lanes[HiP1][a] < _lanes[Lo1][b] || _lanes[LoM1][a] > _lanes[Hi1][b];
+        }
+
+        void sweep() {
+            using P = simd::pack<T>;
+            const std::size_t n = _order.size();
+            const Index* ids = _ids.data();
+            const T* lane[LaneCount];
+            for (std::size_t l = 0; l < LaneCount; ++l)
+                lane[l] = _lanes[l].data();
+            _pairs.clear();
+
+            for (std::size_t i = 0; i < n; ++i) {
+                T a[LaneCount];
+                for (std::size_t l = 0; l < LaneCount; ++l)
+                    a[l] = lane[l][i];
+
+                /*
+                 * Tests rect i against the rects at [j, j + width). Lanes are rejected when both
+                 * index orders of the test say "separated", the few left go through the exact
+                 * test. Returns true once the sweep can stop: lo only grows from here and both
+                 * forms of the sweep axis test reject.
+                 */
+                auto scan = [&](auto p, std::size_t j) {
+                    using Q = decltype(p);
+                    auto at = [&](Lane l) { return Q::load(lane[l] + j); };
+                    auto one = [&](Lane l) { return Q::broadcast(a[l]); };
+
+                    const unsigned before = Q::bits(lt(one(HiP0), at(Lo0)));
+                    const unsigned after = Q::bits(gt(at(LoM0), one(Hi0)));
+                    const unsigned stop = before & after;
+
+                    // the sweep axis is left to the exact test, it rarely rejects before `stop`
+                    const unsigned sepAB = Q::bits(lt(one(HiP1), at(Lo1))) | Q::bits(gt(one(LoM1), at(Hi1)));
+                    const unsigned sepBA = Q::bits(lt(at(HiP1), one(Lo1))) | Q::bits(gt(at(LoM1), one(Hi1)));
+
+                    unsigned candidates = ~(sepAB & sepBA) & ((1u << Q::width) - 1u);
+                    if (stop)
+                        candidates &= (stop & (0u - stop)) - 1u; // lanes before the first stop
+
+                    for (; candidates; candidates &= candidates - 1) {
+                        const std::size_t k = j + std::size_t(std::countr_zero(candidates));
+                        const bool ordered = ids[i] < ids[k];
+                        if (!(ordered ? separated(i, k) : separated(k, i)))
+                            _pairs.push_back(ordered ? Pair{ids[i], ids[k]} : Pair{ids[k], ids[i]});
+                    }
+                    return stop != 0;
+                };
+
+                std::size_t j = i + 1;
+                bool done = false;
+                if constexpr (P::width > 1) {
+                    for (; !done && j + P::width <= n; j += P::width)
+                        done = scan(P{}, j);
+                }
+                for (; !done && j < n; ++j)
+                    done = scan(simd::scalar<T>{}, j);
+            }
+        }
+
+        T _margin;
+        std::size_t _axis = 0;
+        std::vector<Key> _order;
+        std::vector<T, simd::aligned_allocator<T>> _lanes[LaneCount];
+        std::vector<Index> _ids;
+        std::vector<Pair> _pairs;
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class SweepAndPrune<double>;
+#endif
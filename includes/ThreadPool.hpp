@@ -0,0 +1,419 @@
+/**
+ * @file ThreadPool.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Work-stealing thread pool with parallel_for / parallel_reduce over index ranges
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * A range [begin, end) is cut into chunks of `grain` indices, the unit of work: body(first, last)
+ * gets one chunk at a time, a contiguous run a SIMD kernel can process in one call. Tasks are
+ * ranges of chunks split in halves on demand (lazy binary splitting): the thread running a task
+ * keeps the lower half and pushes the upper one on its own deque. Owners pop their deque from
+ * the back (the most recent, smallest, cache warm halves), idle threads steal from the front
+ * of the others (the oldest, largest halves), so a few steals are enough to balance uneven
+ * chunks.
+ *
+ * The automatic grain (grain = 0) aims at ~8 chunks per thread, at least `minGrain` indices,
+ * and is a multiple of `chunkAlignment` = 64 indices: when the outputs are indexed like the
+ * input and start on a cache line (std::vector of elements of at least one byte with a 64 byte
+ * aligned base, VectorArray lanes) no two threads write the same cache line, and SIMD loops
+ * only see a scalar tail at the end of the range. Pass an explicit grain for expensive items
+ * (queries, subtrees): it is then used as is.
+ *
+ * The calling thread always takes part and does not return before every chunk is done; while
+ * waiting it runs other tasks, so parallel_for may be nested (a body may call parallel_for),
+ * and sleeps when none is runnable.
+ * `threads` bounds the threads running chunks of one call at once, caller included: 1 runs
+ * everything inline, 0 = every thread of the pool. The first exception thrown by a body is
+ * rethrown to the caller once the other chunks are done (chunks not started yet are skipped).
+ */
+
+namespace parallel_detail {
+
+    // Automatic chunk boundaries are multiples of it: one cache line of 1 byte outputs.
+    constexpr std::size_t chunkAlignment = 64;
+
+    // Smallest automatic chunk, below it task overhead outweighs cheap per index work.
+    constexpr std::size_t minGrain = 1024;
+
+    inline std::size_t grainSize(std::size_t n, unsigned threads, std::size_t grain) {
+        if (grain)
+            return grain;
+        grain = std::max(n / (std::size_t(threads) * 8), minGrain);
+        return (grain + chunkAlignment - 1) / chunkAlignment * chunkAlignment;
+    }
+
+    inline std::size_t chunkCount(std::size_t n, std::size_t grain) {
+        return n / grain + (n % grain != 0);
+    }
+
+    // Fewest items worth a thread of their own in a data structure build or batch.
+    constexpr std::size_t minItemsPerThread = 4096;
+
+    // `threads` of a build or batch over n items: 0 = hardware concurrency from `threshold` items on, 1 below.
+    inline unsigned resolveThreads(unsigned threads, std::size_t n, std::size_t threshold) {
+        if (threads == 0)
+            threads = n >= threshold ? std::max(1u, std::thread::hardware_concurrency()) : 1u;
+        return unsigned(std::max<std::size_t>(1, std::min<std::size_t>(threads, n / minItemsPerThread)));
+    }
+
+    // One parallel_for / parallel_reduce call, lives on the caller's stack.
+    struct Job {
+        void (*run)(Job& job, std::size_t chunk);
+        void* body;
+        std::size_t begin, end, grain;
+        std::thread::id owner;
+        std::atomic<unsigned> slots{0};             // threads other than the owner still allowed in
+        std::atomic<std::size_t> remaining{0};      // chunks not finished
+        std::atomic<bool> failed{false};
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    // body(chunk, first, last)
+    template <typename F>
+    void runChunk(Job& job, std::size_t chunk) {
+        const std::size_t first = job.begin + chunk * job.grain;
+        (*static_cast<F*>(job.body))(chunk, first, first + std::min(job.grain, job.end - first));
+    }
+
+    // Result of one chunk of parallel_reduce, on its own cache line: neighbouring chunks are
+    // written by different threads (and a std::vector<bool> would pack them into one word).
+    template <typename R>
+    struct alignas(64) Partial {
+        R value;
+    };
+
+    // Chunks [first, last) of one job.
+    struct Task {
+        Job* job;
+        std::size_t first, last;
+    };
+
+    struct alignas(64) Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // Pool and queue of the running thread, null / 0 outside of the workers.
+    inline thread_local const void* currentPool = nullptr;
+    inline thread_local unsigned currentQueue = 0;
+
+} // namespace parallel_detail
+
+/**
+ * @brief fixed set of worker threads with one task deque each
+ *
+ * Queue 0 is shared by the threads that are not workers of the pool, worker i owns queue i.
+ * Idle workers sleep until a task is pushed.
+ */
+class ThreadPool {
+    public:
+        static constexpr unsigned maxThreads = 256;
+
+        // `threads` includes the calling thread (threads - 1 workers), 0 = hardware concurrency.
+        explicit ThreadPool(unsigned threads = 0) : _queues(maxThreads) {
+            _queues[0] = std::make_unique<parallel_detail::Queue>();
+            reserve(threads ? threads : std::max(1u, std::thread::hardware_concurrency()));
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (auto& worker : _workers)
+                worker.join();
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Pool used by the free parallel_for / parallel_reduce, hardware concurrency threads.
+        static ThreadPool& global() {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        // Threads, the caller included.
+        unsigned size() const { return _size.load(std::memory_order_acquire); }
+
+        // Starts workers until the pool has `threads` threads (at most maxThreads).
+        void reserve(unsigned threads) {
+            std::lock_guard<std::mutex> lock(_growMutex);
+            threads = std::min(threads, maxThreads);
+            for (unsigned i = size(); i < threads; ++i) {
+                _queues[i] = std::make_unique<parallel_detail::Queue>();
+                _workers.emplace_back([this, i] { work(i); });
+                _size.store(i + 1, std::memory_order_release);
+            }
+        }
+
+        // ---------- Loops ----------
+        /**
+         * @brief calls body(first, last) over chunks covering [begin, end)
+         * @param threads threads running chunks at once, caller included; 0 = size()
+         * @param grain indices per chunk, 0 = automatic
+         */
+        template <typename F>
+        void parallel_for(std::size_t begin, std::size_t end, F&& body, unsigned threads = 0, std::size_t grain = 0) {
+            if (end <= begin)
+                return;
+            threads = resolve(threads);
+            grain = parallel_detail::grainSize(end - begin, threads, grain);
+            if (threads <= 1 || end - begin <= grain) {
+                body(begin, end);
+                return;
+            }
+            auto fn = [&body](std::size_t, std::size_t first, std::size_t last) { body(first, last); };
+            forChunks(begin, end, grain, threads, fn);
+        }
+
+        /**
+         * @brief combine(... combine(combine(identity, map(c0)), map(c1)) ..., map(cn)) over the chunks
+         *
+         * The partial results are combined in chunk order on the caller: with an explicit grain the
+         * result does not depend on the number of threads, floating point sums included.
+         */
+        template <typename R, typename Map, typename Combine>
+        R parallel_reduce(std::size_t begin, std::size_t end, R identity, Map&& map, Combine&& combine,
+                          unsigned threads = 0, std::size_t grain = 0) {
+            if (end <= begin)
+                return identity;
+            threads = resolve(threads);
+            grain = parallel_detail::grainSize(end - begin, threads, grain);
+            std::vector<parallel_detail::Partial<R>> partials(parallel_detail::chunkCount(end - begin, grain), {identity});
+            auto fn = [&](std::size_t chunk, std::size_t first, std::size_t last) { partials[chunk].value = map(first, last); };
+            forChunks(begin, end, grain, threads, fn);
+            for (auto& partial : partials)
+                identity = combine(std::move(identity), std::move(partial.value));
+            return identity;
+        }
+
+    private:
+        using Job = parallel_detail::Job;
+        using Task = parallel_detail::Task;
+
+        unsigned resolve(unsigned threads) const {
+            return threads == 0 ? size() : std::min(threads, size());
+        }
+
+        unsigned self() const {
+            return parallel_detail::currentPool == this ? parallel_detail::currentQueue : 0u;
+        }
+
+        // fn(chunk, first, last) for every chunk of `grain` indices, returns once all are done.
+        template <typename F>
+        void forChunks(std::size_t begin, std::size_t end, std::size_t grain, unsigned threads, F& fn) {
+            const std::size_t chunks = parallel_detail::chunkCount(end - begin, grain);
+            if (threads <= 1 || chunks <= 1) {
+                for (std::size_t c = 0; c < chunks; ++c)
+                    fn(c, begin + c * grain, begin + c * grain + std::min(grain, end - begin - c * grain));
+                return;
+            }
+
+            Job job;
+            job.run = &parallel_detail::runChunk<F>;
+            job.body = &fn;
+            job.begin = begin;
+            job.end = end;
+            job.grain = grain;
+            job.owner = std::this_thread::get_id();
+            job.slots.store(threads - 1, std::memory_order_relaxed);
+            job.remaining.store(chunks, std::memory_order_relaxed);
+
+            const unsigned queue = self();
+            execute(queue, {&job, 0, chunks});
+            job.remaining.fetch_sub(1, std::memory_order_acq_rel);
+            while (job.remaining.load() != 0) {
+                const std::uint64_t epoch = _epoch.load();
+                if (runOne(queue))
+                    continue;
+                // nothing runnable: sleep until a push or until the last chunk is done (see runOne)
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                _sleeping.fetch_add(1);
+                _wake.wait(lock, [&] { return job.remaining.load() == 0 || _epoch.load() != epoch; });
+                _sleeping.fetch_sub(1);
+            }
+
+            if (job.error)
+                std::rethrow_exception(job.error);
+        }
+
+        // Splits `task` down to its first chunk, pushing the upper halves, and runs that chunk.
+        void execute(unsigned queue, Task task) {
+            while (task.last - task.first > 1) {
+                const std::size_t mid = task.first + (task.last - task.first) / 2;
+                push(queue, {task.job, mid, task.last});
+                task.last = mid;
+            }
+
+            Job& job = *task.job;
+            if (job.failed.load(std::memory_order_relaxed))
+                return;
+            try {
+                job.run(job, task.first);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(job.errorMutex);
+                if (!job.error)
+                    job.error = std::current_exception();
+                job.failed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        void push(unsigned queue, const Task& task) {
+            {
+                parallel_detail::Queue& q = *_queues[queue];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                q.tasks.push_back(task);
+            }
+            _epoch.fetch_add(1);
+            if (_sleeping.load() != 0) {
+                { std::lock_guard<std::mutex> lock(_sleepMutex); }
+                _wake.notify_one();
+            }
+        }
+
+        // The owner of a job always runs its chunks, other threads need one of its slots.
+        static bool admit(Job& job, bool& slot) {
+            slot = job.owner != std::this_thread::get_id();
+            if (!slot)
+                return true;
+            unsigned free = job.slots.load(std::memory_order_relaxed);
+            while (free != 0 && !job.slots.compare_exchange_weak(free, free - 1, std::memory_order_relaxed))
+                ;
+            return free != 0;
+        }
+
+        /*
+         * Takes the first admitted task of `queue`, from the back for the own queue (newest), from
+         * the front for another one (steal, oldest). Tasks without a free slot are skipped rather
+         * than blocking the queue: an owner reaches every queued chunk of its job, so it only
+         * sleeps when they all are running.
+         */
+        bool take(unsigned queue, bool own, Task& task, bool& slot) {
+            parallel_detail::Queue& q = *_queues[queue];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            const std::size_t n = q.tasks.size();
+            for (std::size_t k = 0; k < n; ++k) {
+                const auto it = q.tasks.begin() + std::ptrdiff_t(own ? n - 1 - k : k);
+                if (admit(*it->job, slot)) {
+                    task = *it;
+                    q.tasks.erase(it);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Runs one task from the own queue or stolen from another one, false when none is admitted.
+        bool runOne(unsigned queue) {
+            Task task;
+            bool slot = false;
+            if (!take(queue, true, task, slot)) {
+                const unsigned n = size();
+                unsigned k = 1;
+                while (k < n && !take((queue + k) % n, false, task, slot))
+                    ++k;
+                if (k >= n)
+                    return false;
+            }
+
+            Job& job = *task.job;
+            execute(queue, task);
+            if (slot)
+                job.slots.fetch_add(1, std::memory_order_relaxed);
+            // last access to the job: its owner may return as soon as remaining reaches 0. Both are
+            // sequentially consistent with the owner's _sleeping and predicate, as in push().
+            if (job.remaining.fetch_sub(1) == 1 && slot && _sleeping.load() != 0) {
+                { std::lock_guard<std::mutex> lock(_sleepMutex); }
+                _wake.notify_all();
+            }
+            return true;
+        }
+
+        void work(unsigned queue) {
+            parallel_detail::currentPool = this;
+            parallel_detail::currentQueue = queue;
+            for (;;) {
+                const std::uint64_t epoch = _epoch.load();
+                if (runOne(queue))
+                    continue;
+                // sleep until the next push; _sleeping and _epoch are both sequentially consistent,
+                // so either push() sees the sleeper or the predicate sees the new epoch
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                _sleeping.fetch_add(1);
+                _wake.wait(lock, [&] { return _stop || _epoch.load() != epoch; });
+                _sleeping.fetch_sub(1);
+                if (_stop)
+                    return;
+            }
+        }
+
+        std::vector<std::unique_ptr<parallel_detail::Queue>> _queues;   // maxThreads slots, never reallocated
+        std::vector<std::thread> _workers;
+        std::atomic<unsigned> _size{1};
+        std::mutex _growMutex;
+
+        std::atomic<std::uint64_t> _epoch{0};   // pushes so far
+        std::atomic<unsigned> _sleeping{0};
+        std::mutex _sleepMutex;
+        std::condition_variable _wake;
+        bool _stop = false;
+};
+
+// ---------- Global pool ----------
+/**
+ * @brief ThreadPool::parallel_for on ThreadPool::global()
+ *
+ * An explicit `threads` larger than the pool starts the missing workers; 1 runs body(begin, end)
+ * inline without touching the pool.
+ */
+template <typename F>
+void parallel_for(std::size_t begin, std::size_t end, F&& body, unsigned threads = 0, std::size_t grain = 0) {
+    if (threads == 1) {
+        if (begin < end)
+            body(begin, end);
+        return;
+    }
+    ThreadPool& pool = ThreadPool::global();
+    if (threads > pool.size())
+        pool.reserve(threads);
+    pool.parallel_for(begin, end, std::forward<F>(body), threads, grain);
+}
+
+// ThreadPool::parallel_reduce on ThreadPool::global(), same `threads` rule as parallel_for.
+template <typename R, typename Map, typename Combine>
+R parallel_reduce(std::size_t begin, std::size_t end, R identity, Map&& map, Combine&& combine,
+                  unsigned threads = 0, std::size_t grain = 0) {
+    if (threads == 1) {
+        if (end <= begin)
+            return identity;
+        grain = parallel_detail::grainSize(end - begin, 1, grain);
+        for (std::size_t first = begin; first < end; first += std::min(grain, end - first))
+            identity = combine(std::move(identity), map(first, first + std::min(grain, end - first)));
+        return identity;
+    }
+    ThreadPool& pool = ThreadPool::global();
+    if (threads > pool.size())
+        pool.reserve(threads);
+    return pool.parallel_reduce(begin, end, std::move(identity), std::forward<Map>(map), std::forward<Combine>(combine),
+                                threads, grain);
+}
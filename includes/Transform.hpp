@@ -0,0 +1,180 @@
+/**
+ * @file Transform.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Apply a 4x4 Matrix to single vectors or whole buffers of points / directions
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "Matrix.hpp"
+#include "Simd.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+#include "VectorArray.hpp"
+
+// Convention: vectors are columns, p' = M * (x, y, z, 1), the translation lives in column 3.
+
+// ---------- Helpers ----------
+// True when the last row is (0, 0, 0, 1): no projective divide is needed.
+template <typename T>
+constexpr bool isAffine(const Matrix<T, 4, 4>& m) {
+    return m.data[3][0] == T(0) && m.data[3][1] == T(0) && m.data[3][2] == T(0) && m.data[3][3] == T(1);
+}
+
+// ---------- Single vector ----------
+template <typename T>
+constexpr Vector3<T> transformPoint(const Matrix<T, 4, 4>& m, const Vector3<T>& p) {
+    const auto& d = m.data;
+    Vector3<T> r = {
+        d[0][0] * p.x + d[0][1] * p.y + d[0][2] * p.z + d[0][3],
+        d[1][0] * p.x + d[1][1] * p.y + d[1][2] * p.z + d[1][3],
+        d[2][0] * p.x + d[2][1] * p.y + d[2][2] * p.z + d[2][3]
+    };
+
+    if (isAffine(m))
+        return r;
+    T w = d[3][0] * p.x + d[3][1] * p.y + d[3][2] * p.z + d[3][3];
+    return {r.x / w, r.y / w, r.z / w};
+}
+
+// Directions ignore the translation and are never divided.
+template <typename T>
+constexpr Vector3<T> transformDirection(const Matrix<T, 4, 4>& m, const Vector3<T>& v) {
+    const auto& d = m.data;
+    return {
+        d[0][0] * v.x + d[0][1] * v.y + d[0][2] * v.z,
+        d[1][0] * v.x + d[1][1] * v.y + d[1][2] * v.z,
+        d[2][0] * v.x + d[2][1] * v.y + d[2][2] * v.z
+    };
+}
+
+// ---------- SoA kernels ----------
+namespace transform_detail {
+
+    // Transform `n` vectors stored as lanes, `in` and `out` may alias.
+    // Mode: 0 = direction, 1 = affine point, 2 = projective point
+    template <int Mode, typename T>
+    void lanes(const Matrix<T, 4, 4>& m, const T* ix, const T* iy, const T* iz, T* ox, T* oy, T* oz, std::size_t n) {
+        const auto& d = m.data;
+
+        simd::for_each<T>(n, [&](auto p, std::size_t i) {
+            using P = decltype(p);
+            const P x = P::load(ix + i), y = P::load(iy + i), z = P::load(iz + i);
+
+            auto row = [&](std::size_t r) {
+                P acc = P::broadcast(d[r][0]) * x + P::broadcast(d[r][1]) * y + P::broadcast(d[r][2]) * z;
+                if constexpr (Mode != 0)
+                    acc = acc + P::broadcast(d[r][3]);
+                return acc;
+            };
+
+            P rx = row(0), ry = row(1), rz = row(2);
+            if constexpr (Mode == 2) {
+                P w = row(3);
+                rx = rx / w;
+                ry = ry / w;
+                rz = rz / w;
+            }
+            rx.store(ox + i);
+            ry.store(oy + i);
+            rz.store(oz + i);
+        });
+    }
+
+    template <int Mode, typename T>
+    void aos(const Matrix<T, 4, 4>& m, std::span<const Vector3<T>> in, std::span<Vector3<T>> out) {
+        // Blocks small enough to stay in L1, converted to lanes on the stack (no allocation).
+        constexpr std::size_t block = 256;
+        alignas(simd::alignment) T x[block], y[block], z[block];
+
+        for (std::size_t first = 0; first < in.size(); first += block) {
+            const std::size_t n = std::min(block, in.size() - first);
+
+            for (std::size_t i = 0; i < n; ++i) {
+                x[i] = in[first + i].x;
+                y[i] = in[first + i].y;
+                z[i] = in[first + i].z;
+            }
+            lanes<Mode>(m, x, y, z, x, y, z, n);
+            for (std::size_t i = 0; i < n; ++i)
+                out[first + i] = {x[i], y[i], z[i]};
+        }
+    }
+
+} // namespace transform_detail
+
+// ---------- Batches ----------
+/**
+ * @brief out[i] = transformPoint(m, in[i]), vectorised across points
+ *
+ * `out` must hold at least in.size() elements and may be the same buffer as `in`.
+ * Affine matrices skip the projective divide.
+ */
+template <typename T>
+void transformPoints(const Matrix<T, 4, 4>& m, std::span<const Vector3<std::type_identity_t<T>>> in, std::span<Vector3<std::type_identity_t<T>>> out) {
+    if (isAffine(m))
+        transform_detail::aos<1>(m, in, out);
+    else
+        transform_detail::aos<2>(m, in, out);
+}
+
+// out[i] = transformDirection(m, in[i])
+template <typename T>
+void transformDirections(const Matrix<T, 4, 4>& m, std::span<const Vector3<std::type_identity_t<T>>> in, std::span<Vector3<std::type_identity_t<T>>> out) {
+    transform_detail::aos<0>(m, in, out);
+}
+
+template <typename T>
+void transformPoints(const Matrix<T, 4, 4>& m, const Vector3Array<T>& in, Vector3Array<T>& out) {
+    out.resize(in.size());
+    if (isAffine(m))
+        transform_detail::lanes<1>(m, in.lane(0), in.lane(1), in.lane(2), out.lane(0), out.lane(1), out.lane(2), in.size());
+    else
+        transform_detail::lanes<2>(m, in.lane(0), in.lane(1), in.lane(2), out.lane(0), out.lane(1), out.lane(2), in.size());
+}
+
+template <typename T>
+void transformDirections(const Matrix<T, 4, 4>& m, const Vector3Array<T>& in, Vector3Array<T>& out) {
+    out.resize(in.size());
+    transform_detail::lanes<0>(m, in.lane(0), in.lane(1), in.lane(2), out.lane(0), out.lane(1), out.lane(2), in.size());
+}
+
+// out[i] = m * in[i] for homogeneous vectors, no divide
+template <typename T>
+void transform(const Matrix<T, 4, 4>& m, std::span<const Vector4<std::type_identity_t<T>>> in, std::span<Vector4<std::type_identity_t<T>>> out) {
+    const auto& d = m.data;
+    constexpr std::size_t block = 256;
+    alignas(simd::alignment) T x[block], y[block], z[block], w[block];
+
+    for (std::size_t first = 0; first < in.size(); first += block) {
+        const std::size_t n = std::min(block, in.size() - first);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = in[first + i].x;
+            y[i] = in[first + i].y;
+            z[i] = in[first + i].z;
+            w[i] = in[first + i].w;
+        }
+        simd::for_each<T>(n, [&](auto p, std::size_t i) {
+            using P = decltype(p);
+            const P vx = P::load(x + i), vy = P::load(y + i), vz = P::load(z + i), vw = P::load(w + i);
+
+            auto row = [&](std::size_t r) {
+                return P::broadcast(d[r][0]) * vx + P::broadcast(d[r][1]) * vy + P::broadcast(d[r][2]) * vz + P::broadcast(d[r][3]) * vw;
+            };
+            P rx = row(0), ry = row(1), rz = row(2), rw = row(3);
+            rx.store(x + i);
+            ry.store(y + i);
+            rz.store(z + i);
+            rw.store(w + i);
+        });
+        for (std::size_t i = 0; i < n; ++i)
+            out[first + i] = {w[i], x[i], y[i], z[i]};
+    }
+}
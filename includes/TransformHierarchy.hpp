@@ -0,0 +1,402 @@
+/**
+ * @file TransformHierarchy.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Flat parent-ordered transform hierarchy with lazily recomputed world matrices
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "ThreadPool.hpp"
+#include "Vector3.hpp"
+
+/**
+ * @brief scene graph transforms stored as flat arrays, parents before children
+ *
+ * Every node has a local rotation (unit quaternion), translation and scale. Its local matrix
+ * is T * R * S and world(i) = world(parent(i)) * local(i). Nodes are only appended and a
+ * parent always has a smaller index than its children, so one forward pass sees every parent
+ * before its children.
+ *
+ * Setters only record the node. When nodes are appended depth first (the parent of a new node
+ * is the last node or one of its ancestors, the order a scene file is usually loaded in) every
+ * subtree is a contiguous index range: update() recomputes exactly the subtrees of the changed
+ * nodes, each one a linear pass over [i, end of subtree), and untouched nodes cost nothing.
+ * add() keeps the path from the root to the last node, so an append is amortized O(1) even
+ * for deep chains.
+ * These passes can be split across threads: the few nodes with large subtrees are computed
+ * first on the caller, the remaining subtrees are independent ranges run on the thread pool.
+ *
+ * Any other append order keeps update() correct but falls back to one flag-driven pass from
+ * the first changed index (a node is recomputed when it or its parent changed), single
+ * threaded, until sortDepthFirst() renumbers the nodes.
+ */
+template <typename T>
+class TransformHierarchy {
+    static_assert(std::is_floating_point<T>::value, "TransformHierarchy needs a floating point type");
+
+    public:
+        using Index = std::uint32_t;
+
+        static constexpr Index none = std::numeric_limits<Index>::max();
+        static constexpr std::size_t parallelThreshold = 100000;
+
+        std::size_t size() const { return _parent.size(); }
+        bool empty() const { return _parent.empty(); }
+
+        // True when every subtree is a contiguous index range (update() may use threads).
+        bool depthFirst() const { return _depthFirst; }
+
+        // True when some world matrix is out of date.
+        bool dirty() const { return !_touched.empty(); }
+
+        void reserve(std::size_t n) {
+            _parent.reserve(n);
+            _end.reserve(n);
+            _rotation.reserve(n);
+            _translation.reserve(n);
+            _scale.reserve(n);
+            _world.reserve(n);
+            _dirty.reserve(n);
+        }
+
+        void clear() {
+            _parent.clear();
+            _end.clear();
+            _rotation.clear();
+            _translation.clear();
+            _scale.clear();
+            _world.clear();
+            _dirty.clear();
+            _touched.clear();
+            _open.clear();
+            _depthFirst = true;
+            _planThreads = 0;
+        }
+
+        /**
+         * @brief appends a node and returns its index
+         * @param parent an existing node, or none for a root
+         */
+        Index add(Index parent, const Quaternion<T>& rotation = {}, const Vector3<T>& translation = {0, 0, 0},
+                  const Vector3<T>& scale = {1, 1, 1}) {
+            const Index i = Index(size());
+
+            // still depth first when the parent is on the open path, the subtrees below it end here
+            if (_depthFirst) {
+                while (!_open.empty() && _open.back() != parent) {
+                    _end[_open.back()] = i;
+                    _open.pop_back();
+                }
+                if (parent != none && _open.empty())
+                    _depthFirst = false;
+                else
+                    _open.push_back(i);
+            }
+
+            _parent.push_back(parent);
+            _end.push_back(i + 1);
+            _rotation.push_back(rotation);
+            _translation.push_back(translation);
+            _scale.push_back(scale);
+            _world.emplace_back();
+            _dirty.push_back(0);
+            _planThreads = 0;
+            touch(i);
+            return i;
+        }
+
+        // ---------- Local transform ----------
+        Index parent(Index i) const { return _parent[i]; }
+        const Quaternion<T>& rotation(Index i) const { return _rotation[i]; }
+        const Vector3<T>& translation(Index i) const { return _translation[i]; }
+        const Vector3<T>& scale(Index i) const { return _scale[i]; }
+
+        void setRotation(Index i, const Quaternion<T>& rotation) {
+            _rotation[i] = rotation;
+            touch(i);
+        }
+
+        void setTranslation(Index i, const Vector3<T>& translation) {
+            _translation[i] = translation;
+            touch(i);
+        }
+
+        void setScale(Index i, const Vector3<T>& scale) {
+            _scale[i] = scale;
+            touch(i);
+        }
+
+        void setLocal(Index i, const Quaternion<T>& rotation, const Vector3<T>& translation, const Vector3<T>& scale) {
+            _rotation[i] = rotation;
+            _translation[i] = translation;
+            _scale[i] = scale;
+            touch(i);
+        }
+
+        // T * R * S of node i
+        Matrix<T, 4, 4> local(Index i) const { return compose(_rotation[i], _translation[i], _scale[i]); }
+
+        // World matrix as of the last update().
+        const Matrix<T, 4, 4>& world(Index i) const { return _world[i]; }
+
+        // ---------- Update ----------
+        /**
+         * @brief recomputes the world matrices of the changed nodes and their subtrees
+         * @param threads 0 = hardware concurrency when size() >= parallelThreshold, 1 otherwise;
+         *        only used when depthFirst()
+         */
+        void update(unsigned threads = 0) {
+            if (_touched.empty())
+                return;
+
+            if (!_depthFirst) {
+                const std::size_t first = *std::min_element(_touched.begin(), _touched.end());
+                pass(first, size());
+                std::fill(_dirty.begin() + std::ptrdiff_t(first), _dirty.end(), std::uint8_t(0));
+                _touched.clear();
+                return;
+            }
+
+            // the subtrees still open end at the last node
+            for (Index a : _open)
+                _end[a] = Index(size());
+
+            // subtrees of the changed nodes, sorted, the ones nested in another dropped
+            std::sort(_touched.begin(), _touched.end());
+            _ranges.clear();
+            std::size_t count = 0;
+            for (Index i : _touched) {
+                _dirty[i] = 0;
+                if (_ranges.empty() || i >= _ranges.back().end) {
+                    _ranges.push_back({i, _end[i]});
+                    count += _end[i] - i;
+                }
+            }
+            _touched.clear();
+
+            threads = parallel_detail::resolveThreads(threads, count, parallelThreshold);
+            if (threads <= 1) {
+                for (const Range& r : _ranges)
+                    recompute(r.begin, r.end);
+                return;
+            }
+
+            if (_planThreads != threads)
+                plan(threads);
+
+            for (Index i : _spine)
+                if (changed(i))
+                    recompute(i, i + 1);
+
+            parallel_for(0, _tasks.size(), [&](std::size_t first, std::size_t last) {
+                for (std::size_t k = first; k < last; ++k) {
+                    const Range task = _tasks[k];
+                    auto r = std::upper_bound(_ranges.begin(), _ranges.end(), task.begin,
+                                              [](Index i, const Range& range) { return i < range.end; });
+                    for (; r != _ranges.end() && r->begin < task.end; ++r)
+                        recompute(std::max(r->begin, task.begin), std::min(r->end, task.end));
+                }
+            }, threads, 1);
+        }
+
+        /**
+         * @brief renumbers the nodes in depth first order (children in their current order)
+         *
+         * @return new index of every old index
+         */
+        std::vector<Index> sortDepthFirst() {
+            const std::size_t n = size();
+            std::vector<Index> remap(n);
+            if (_depthFirst) {
+                std::iota(remap.begin(), remap.end(), Index(0));
+                return remap;
+            }
+
+            // children of every node in index order (counting sort by parent)
+            std::vector<Index> start(n + 1, 0), children(n);
+            for (std::size_t i = 0; i < n; ++i)
+                if (_parent[i] != none)
+                    ++start[_parent[i] + 1];
+            std::partial_sum(start.begin(), start.end(), start.begin());
+            std::vector<Index> cursor(start.begin(), start.end() - 1);
+            for (std::size_t i = 0; i < n; ++i)
+                if (_parent[i] != none)
+                    children[cursor[_parent[i]]++] = Index(i);
+
+            std::vector<Index> order;
+            order.reserve(n);
+            std::vector<Index> stack;
+            for (std::size_t r = n; r-- > 0;)
+                if (_parent[r] == none)
+                    stack.push_back(Index(r));
+            while (!stack.empty()) {
+                const Index i = stack.back();
+                stack.pop_back();
+                remap[i] = Index(order.size());
+                order.push_back(i);
+                for (Index c = start[i + 1]; c-- > start[i];)
+                    stack.push_back(children[c]);
+            }
+
+            std::vector<Index> parent(n);
+            for (std::size_t i = 0; i < n; ++i)
+                parent[i] = _parent[order[i]] == none ? none : remap[_parent[order[i]]];
+            _parent = std::move(parent);
+            permute(_rotation, order);
+            permute(_translation, order);
+            permute(_scale, order);
+            permute(_world, order);
+            permute(_dirty, order);
+            for (Index& i : _touched)
+                i = remap[i];
+
+            for (std::size_t i = 0; i < n; ++i)
+                _end[i] = Index(i + 1);
+            for (std::size_t i = n; i-- > 0;)
+                if (_parent[i] != none)
+                    _end[_parent[i]] = std::max(_end[_parent[i]], _end[i]);
+            _open.clear();
+            for (Index a = n ? Index(n - 1) : none; a != none; a = _parent[a])
+                _open.push_back(a);
+            std::reverse(_open.begin(), _open.end());
+
+            _depthFirst = true;
+            _planThreads = 0;
+            return remap;
+        }
+
+    private:
+        struct Range {
+            Index begin, end;
+        };
+
+        static Matrix<T, 4, 4> compose(const Quaternion<T>& rotation, const Vector3<T>& translation, const Vector3<T>& scale) {
+            Matrix<T, 4, 4> m = rotation.toMatrix();
+            for (std::size_t k = 0; k < 3; ++k) {
+                m.data[k][0] *= scale.x;
+                m.data[k][1] *= scale.y;
+                m.data[k][2] *= scale.z;
+            }
+            m.data[0][3] = translation.x;
+            m.data[1][3] = translation.y;
+            m.data[2][3] = translation.z;
+            return m;
+        }
+
+        template <typename V>
+        static void permute(std::vector<V>& values, const std::vector<Index>& order) {
+            std::vector<V> sorted(values.size());
+            for (std::size_t i = 0; i < order.size(); ++i)
+                sorted[i] = values[order[i]];
+            values = std::move(sorted);
+        }
+
+        void touch(Index i) {
+            if (!_dirty[i]) {
+                _dirty[i] = 1;
+                _touched.push_back(i);
+            }
+        }
+
+        // i inside a subtree of a changed node
+        bool changed(Index i) const {
+            auto r = std::upper_bound(_ranges.begin(), _ranges.end(), i, [](Index j, const Range& range) { return j < range.end; });
+            return r != _ranges.end() && r->begin <= i;
+        }
+
+        // Every node of [begin, end), parents are up to date. The arrays are read through local
+        // pointers, a store through a member vector would make the compiler reload them.
+        void recompute(std::size_t begin, std::size_t end) {
+            const Index* parent = _parent.data();
+            const Quaternion<T>* rotation = _rotation.data();
+            const Vector3<T>* translation = _translation.data();
+            const Vector3<T>* scale = _scale.data();
+            Matrix<T, 4, 4>* world = _world.data();
+
+            for (std::size_t i = begin; i < end; ++i) {
+                const Matrix<T, 4, 4> local = compose(rotation[i], translation[i], scale[i]);
+                world[i] = parent[i] == none ? local : world[parent[i]] * local;
+            }
+        }
+
+        // Flag-driven pass, the flag of a recomputed node stays set until the end of update().
+        void pass(std::size_t begin, std::size_t end) {
+            const Index* parent = _parent.data();
+            std::uint8_t* dirty = _dirty.data();
+
+            for (std::size_t i = begin; i < end; ++i) {
+                const Index p = parent[i];
+                if (dirty[i] || (p != none && dirty[p])) {
+                    dirty[i] = 1;
+                    recompute(i, i + 1);
+                }
+            }
+        }
+
+        /*
+         * Splits the (depth first) nodes into whole subtrees of at most `grain` nodes. The nodes
+         * whose subtree is larger go to the spine, computed on the caller before the subtrees;
+         * the subtrees are tasks of the thread pool, about 8 per thread to balance uneven ones.
+         */
+        void plan(unsigned threads) {
+            const std::size_t n = size();
+            const std::size_t grain = std::max<std::size_t>(1024, n / (std::size_t(threads) * 8));
+
+            _spine.clear();
+            _tasks.clear();
+            std::vector<Range> stack = {{0, Index(n)}};
+            while (!stack.empty()) {
+                Range& siblings = stack.back();
+                if (siblings.begin >= siblings.end) {
+                    stack.pop_back();
+                    continue;
+                }
+                const Index i = siblings.begin;
+                siblings.begin = _end[i];
+                if (_end[i] - i <= grain) {
+                    if (!_tasks.empty() && _tasks.back().end == i && _end[i] - _tasks.back().begin <= grain)
+                        _tasks.back().end = _end[i];
+                    else
+                        _tasks.push_back({i, _end[i]});
+                } else {
+                    _spine.push_back(i);
+                    stack.push_back({i + 1, _end[i]});
+                }
+            }
+            _planThreads = threads;
+        }
+
+        std::vector<Index> _parent;
+        std::vector<Index> _end;                    // one past the last node of the subtree, if _depthFirst
+        std::vector<Index> _open;                   // root to last node path, their _end is set by update()
+        std::vector<Quaternion<T>> _rotation;
+        std::vector<Vector3<T>> _translation;
+        std::vector<Vector3<T>> _scale;
+        std::vector<Matrix<T, 4, 4>> _world;
+        std::vector<std::uint8_t> _dirty;           // set for the nodes in _touched
+        std::vector<Index> _touched;                // changed since the last update()
+        std::vector<Range> _ranges;                 // subtrees recomputed by update()
+
+        bool _depthFirst = true;
+
+        // update() split, rebuilt when the structure or the thread count changes
+        unsigned _planThreads = 0;
+        std::vector<Index> _spine;
+        std::vector<Range> _tasks;
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class TransformHierarchy<double>;
+#endif
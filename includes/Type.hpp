@@ -21,19 +21,46 @@
 #include "std.hpp"
 
 // ---------- Vectors ----------
+#include "AabbTree.hpp"
 #include "Color.hpp"
+#include "ColorSpace.hpp"
 #include "Constants.hpp"
 
+#include "Delaunay.hpp"
+
+#include "FlatSet.hpp"
+
+#include "Hash.hpp"
+#include "Image.hpp"
+
+#include "KdTree.hpp"
+
+#include "Lazy.hpp"
+
+#include "Math.hpp"
 #include "Matrix.hpp"
+#include "Memory.hpp"
+
+#include "PointLocation.hpp"
+
+#include "Predicates.hpp"
 
 #include "Quaternion.hpp"
 #include "Quaternion.hpp"
 
+#include "SegmentIntersector.hpp"
 #include "Shape.hpp"
+#include "SpatialGrid.hpp"
+#include "SweepAndPrune.hpp"
+
+#include "ThreadPool.hpp"
+#include "Transform.hpp"
+#include "TransformHierarchy.hpp"
 
 #include "Vector2.hpp"
 #include "Vector3.hpp"
 #include "Vector4.hpp"
+#include "VectorArray.hpp"
 
 // ---------- Lambda ----------
 
@@ -8,6 +8,8 @@
 #pragma once
 
 #include "Constants.hpp"
+#include "Hash.hpp"
+#include "Math.hpp"
 #include <cmath>
 
 template <typename T>
@@ -15,77 +17,61 @@ struct Vector2 {
     T x{}, y{};
 
     // Comparison Operators
-    template<typename = typename std::enable_if<std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value>::type>
-    bool operator==(const Vector2& other) const { return x == other.x && y == other.y; }
+    constexpr bool operator==(const Vector2& other) const requires (std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value) { return x == other.x && y == other.y; }
 
-    template<typename = typename std::enable_if<std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value>::type>
-    bool operator!=(const Vector2& other) const { return !(*this == other); }
+    constexpr bool operator!=(const Vector2& other) const requires (std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value) { return !(*this == other); }
 
     // Arithmetic Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2 operator+(const Vector2& other) const { return Vector2{x + other.x, y + other.y}; }
+    constexpr Vector2 operator+(const Vector2& other) const requires std::is_arithmetic<T>::value { return Vector2{x + other.x, y + other.y}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2 operator-(const Vector2& other) const { return Vector2{x - other.x, y - other.y}; }
+    constexpr Vector2 operator-(const Vector2& other) const requires std::is_arithmetic<T>::value { return Vector2{x - other.x, y - other.y}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2 operator*(T scalar) const { return Vector2{x * scalar, y * scalar}; }
+    constexpr Vector2 operator*(T scalar) const requires std::is_arithmetic<T>::value { return Vector2{x * scalar, y * scalar}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2 operator/(T scalar) const { return Vector2{x / scalar, y / scalar}; }
+    constexpr Vector2 operator/(T scalar) const requires std::is_arithmetic<T>::value { return Vector2{x / scalar, y / scalar}; }
 
     // Compound Assignment Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2& operator+=(const Vector2& other) { x += other.x; y += other.y; return *this; }
+    constexpr Vector2& operator+=(const Vector2& other) requires std::is_arithmetic<T>::value { x += other.x; y += other.y; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2& operator-=(const Vector2& other) { x -= other.x; y -= other.y; return *this; }
+    constexpr Vector2& operator-=(const Vector2& other) requires std::is_arithmetic<T>::value { x -= other.x; y -= other.y; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2& operator*=(T scalar) { x *= scalar; y *= scalar; return *this; }
+    constexpr Vector2& operator*=(T scalar) requires std::is_arithmetic<T>::value { x *= scalar; y *= scalar; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2& operator/=(T scalar) { x /= scalar; y /= scalar; return *this; }
+    constexpr Vector2& operator/=(T scalar) requires std::is_arithmetic<T>::value { x /= scalar; y /= scalar; return *this; }
 
     // Unary Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2 operator-() { return Vector2{-x, -y}; }
+    constexpr Vector2 operator-() const requires std::is_arithmetic<T>::value { return Vector2{-x, -y}; }
 
     //methods    
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    T dot(const Vector2& other) const { return x * other.x + y * other.y; }
+    constexpr T dot(const Vector2& other) const requires std::is_arithmetic<T>::value { return x * other.x + y * other.y; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    T cross(const Vector2& other) const { return x * other.y - y * other.x; }
+    constexpr T cross(const Vector2& other) const requires std::is_arithmetic<T>::value { return x * other.y - y * other.x; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    T square_magnitude() const { return x*x + y*y; }
+    constexpr T square_magnitude() const requires std::is_arithmetic<T>::value { return x*x + y*y; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    typename std::conditional<std::is_floating_point<T>::value, T, double>::type 
-    magnitude() const { return std::sqrt(square_magnitude()); }
+    constexpr typename std::conditional<std::is_floating_point<T>::value, T, double>::type
+    magnitude() const requires std::is_arithmetic<T>::value {
+        using R = typename std::conditional<std::is_floating_point<T>::value, T, double>::type;
+        return math::sqrt(R(square_magnitude()));
+    }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    typename std::conditional<std::is_floating_point<T>::value, T, double>::type
-    distance(const Vector2& other) const { return (*this - other).magnitude(); }
+    constexpr typename std::conditional<std::is_floating_point<T>::value, T, double>::type
+    distance(const Vector2& other) const requires std::is_arithmetic<T>::value { return (*this - other).magnitude(); }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    double angle(const Vector2& other) const {
+    double angle(const Vector2& other) const requires std::is_arithmetic<T>::value {
         double dot = double(this->dot(other));
         double cross = double(this->cross(other));
 
         return std::atan2(cross, dot); // result in radians, can be negative
     }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector2 normalized() const {
+    constexpr Vector2 normalized() const requires std::is_arithmetic<T>::value {
         T len = magnitude();
         if (len == 0) return {0, 0};
         return {T(x / len), T(y / len)};
     }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    void normalize() {
+    constexpr void normalize() requires std::is_arithmetic<T>::value {
         double len = magnitude();
 
         if (len == 0) return;
@@ -93,10 +79,9 @@ struct Vector2 {
         y /= len;
     }
 
-    template<typename U = T, typename = typename std::enable_if<std::is_floating_point<U>::value>::type>
-    bool same(const Vector2& other, T epsilon = epsilon_v<T>) const {
-        return std::abs(x - other.x) < epsilon &&
-               std::abs(y - other.y) < epsilon;
+    constexpr bool same(const Vector2& other, T epsilon = epsilon_v<T>) const requires std::is_floating_point<T>::value {
+        return math::abs(x - other.x) < epsilon &&
+               math::abs(y - other.y) < epsilon;
     };
 };
 
@@ -105,4 +90,18 @@ using Vector2u = Vector2<std::uint32_t>;
 using Vector2i = Vector2<std::int32_t>;
 using Vector2f = Vector2<double>;
 
+// ---------- Hash ----------
+// Consistent with operator== (0.0 and -0.0 hash the same).
+template <typename T>
+struct std::hash<Vector2<T>> {
+    std::size_t operator()(const Vector2<T>& v) const {
+        return std::size_t(hashing::values(v.x, v.y));
+    }
+};
 
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template struct Vector2<std::uint32_t>;
+extern template struct Vector2<std::int32_t>;
+extern template struct Vector2<double>;
+#endif
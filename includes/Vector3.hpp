@@ -9,54 +9,43 @@
 
 #include <cmath>
 #include "Constants.hpp"
+#include "Hash.hpp"
+#include "Math.hpp"
 
 template <typename T>
 struct Vector3 {
     T x{}, y{}, z{};
 
     // Comparison Operators
-    template<typename = typename std::enable_if<std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value>::type>
-    bool operator==(const Vector3& other) const { return x == other.x && y == other.y && z == other.z; }
+    constexpr bool operator==(const Vector3& other) const requires (std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value) { return x == other.x && y == other.y && z == other.z; }
 
-    template<typename = typename std::enable_if<std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value>::type>
-    bool operator!=(const Vector3& other) const { return !(*this == other); }
+    constexpr bool operator!=(const Vector3& other) const requires (std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value) { return !(*this == other); }
 
     // Arithmetic Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3 operator+(const Vector3& other) const { return Vector3{x + other.x, y + other.y, z + other.z}; }
+    constexpr Vector3 operator+(const Vector3& other) const requires std::is_arithmetic<T>::value { return Vector3{x + other.x, y + other.y, z + other.z}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3 operator-(const Vector3& other) const { return Vector3{x - other.x, y - other.y, z - other.z}; }
+    constexpr Vector3 operator-(const Vector3& other) const requires std::is_arithmetic<T>::value { return Vector3{x - other.x, y - other.y, z - other.z}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3 operator*(T scalar) const { return Vector3{x * scalar, y * scalar, z * scalar}; }
+    constexpr Vector3 operator*(T scalar) const requires std::is_arithmetic<T>::value { return Vector3{x * scalar, y * scalar, z * scalar}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3 operator/(T scalar) const { return Vector3{x / scalar, y / scalar, z / scalar}; }
+    constexpr Vector3 operator/(T scalar) const requires std::is_arithmetic<T>::value { return Vector3{x / scalar, y / scalar, z / scalar}; }
 
     // Compound Assignment Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3& operator+=(const Vector3& other) { x += other.x; y += other.y; z += other.z; return *this; }
+    constexpr Vector3& operator+=(const Vector3& other) requires std::is_arithmetic<T>::value { x += other.x; y += other.y; z += other.z; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3& operator-=(const Vector3& other) { x -= other.x; y -= other.y; z -= other.z; return *this; }
+    constexpr Vector3& operator-=(const Vector3& other) requires std::is_arithmetic<T>::value { x -= other.x; y -= other.y; z -= other.z; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3& operator*=(T scalar) { x *= scalar; y *= scalar; z *= scalar; return *this; }
+    constexpr Vector3& operator*=(T scalar) requires std::is_arithmetic<T>::value { x *= scalar; y *= scalar; z *= scalar; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3& operator/=(T scalar) { x /= scalar; y /= scalar; z /= scalar; return *this; }
+    constexpr Vector3& operator/=(T scalar) requires std::is_arithmetic<T>::value { x /= scalar; y /= scalar; z /= scalar; return *this; }
 
     // Unary Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector3 operator-() { return Vector3{-x, -y, -z}; }
+    constexpr Vector3 operator-() const requires std::is_arithmetic<T>::value { return Vector3{-x, -y, -z}; }
 
     //methods    
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    T dot(const Vector3& other) const { return x * other.x + y * other.y + z * other.z; }
+    constexpr T dot(const Vector3& other) const requires std::is_arithmetic<T>::value { return x * other.x + y * other.y + z * other.z; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector3 cross(const Vector3& other) const {
+    constexpr Vector3 cross(const Vector3& other) const requires std::is_arithmetic<T>::value {
         return {
             y * other.z - z * other.y,
             z * other.x - x * other.z,
@@ -64,35 +53,32 @@ struct Vector3 {
         };
     }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    T square_magnitude() const { return x*x + y*y + z*z; }
+    constexpr T square_magnitude() const requires std::is_arithmetic<T>::value { return x*x + y*y + z*z; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    typename std::conditional<std::is_floating_point<T>::value, T, double>::type 
-    magnitude() const { return std::sqrt(square_magnitude()); }
+    constexpr typename std::conditional<std::is_floating_point<T>::value, T, double>::type
+    magnitude() const requires std::is_arithmetic<T>::value {
+        using R = typename std::conditional<std::is_floating_point<T>::value, T, double>::type;
+        return math::sqrt(R(square_magnitude()));
+    }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    typename std::conditional<std::is_floating_point<T>::value, T, double>::type
-    distance(const Vector3& other) const { return (*this - other).magnitude(); }
+    constexpr typename std::conditional<std::is_floating_point<T>::value, T, double>::type
+    distance(const Vector3& other) const requires std::is_arithmetic<T>::value { return (*this - other).magnitude(); }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    double angle(const Vector3& other) const {
+    double angle(const Vector3& other) const requires std::is_arithmetic<T>::value {
         double dot = double(this->dot(other));
-        double cross = double(this->cross(other));
+        double cross = double(this->cross(other).magnitude());
 
-        return std::atan2(cross, dot); // result in radians, can be negative
+        return std::atan2(cross, dot); // result in radians, in [0, pi]
     }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector3 normalized() const {
+    constexpr Vector3 normalized() const requires std::is_arithmetic<T>::value {
         T len = magnitude();
 
         if (len == 0) return {0, 0, 0};
         return {T(x / len), T(y / len), T(z / len)};
     }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    void normalize() {
+    constexpr void normalize() requires std::is_arithmetic<T>::value {
         double len = magnitude();
 
         if (len == 0) return;
@@ -101,14 +87,29 @@ struct Vector3 {
         z /= len;
     }
 
-    template<typename U = T, typename = typename std::enable_if<std::is_floating_point<U>::value>::type>
-    bool same(const Vector3& other, T epsilon = epsilon_v<T>) const {
-        return std::abs(x - other.x) < epsilon &&
-               std::abs(y - other.y) < epsilon &&
-               std::abs(z - other.z) < epsilon;
+    constexpr bool same(const Vector3& other, T epsilon = epsilon_v<T>) const requires std::is_floating_point<T>::value {
+        return math::abs(x - other.x) < epsilon &&
+               math::abs(y - other.y) < epsilon &&
+               math::abs(z - other.z) < epsilon;
     }
 };
 
 using Vector3u = Vector3<std::uint32_t>;
 using Vector3i = Vector3<std::int32_t>;
 using Vector3f = Vector3<double>;
+
+// ---------- Hash ----------
+// Consistent with operator== (0.0 and -0.0 hash the same).
+template <typename T>
+struct std::hash<Vector3<T>> {
+    std::size_t operator()(const Vector3<T>& v) const {
+        return std::size_t(hashing::values(v.x, v.y, v.z));
+    }
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template struct Vector3<std::uint32_t>;
+extern template struct Vector3<std::int32_t>;
+extern template struct Vector3<double>;
+#endif
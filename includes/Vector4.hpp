@@ -9,73 +9,61 @@
 
 #include <cmath>
 #include "Constants.hpp"
+#include "Hash.hpp"
+#include "Math.hpp"
 
 template <typename T>
 struct Vector4 {
     T w{}, x{}, y{}, z{};
 
     // Comparison Operators
-    template<typename = typename std::enable_if<std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value>::type>
-    bool operator==(const Vector4& other) const { return w == other.w && x == other.x && y == other.y && z == other.z; }
+    constexpr bool operator==(const Vector4& other) const requires (std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value) { return w == other.w && x == other.x && y == other.y && z == other.z; }
 
-    template<typename = typename std::enable_if<std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value>::type>
-    bool operator!=(const Vector4& other) const { return !(*this == other); }
+    constexpr bool operator!=(const Vector4& other) const requires (std::is_convertible<decltype(std::declval<T>() == std::declval<T>()), bool>::value) { return !(*this == other); }
 
     // Arithmetic Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4 operator+(const Vector4& other) const { return Vector4{w + other.w, x + other.x, y + other.y, z + other.z}; }
+    constexpr Vector4 operator+(const Vector4& other) const requires std::is_arithmetic<T>::value { return Vector4{w + other.w, x + other.x, y + other.y, z + other.z}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4 operator-(const Vector4& other) const { return Vector4{w - other.w, x - other.x, y - other.y, z - other.z}; }
+    constexpr Vector4 operator-(const Vector4& other) const requires std::is_arithmetic<T>::value { return Vector4{w - other.w, x - other.x, y - other.y, z - other.z}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4 operator*(T scalar) const { return Vector4{w * scalar, x * scalar, y * scalar, z * scalar}; }
+    constexpr Vector4 operator*(T scalar) const requires std::is_arithmetic<T>::value { return Vector4{w * scalar, x * scalar, y * scalar, z * scalar}; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4 operator/(T scalar) const { return Vector4{w / scalar, x / scalar, y / scalar, z / scalar}; }
+    constexpr Vector4 operator/(T scalar) const requires std::is_arithmetic<T>::value { return Vector4{w / scalar, x / scalar, y / scalar, z / scalar}; }
 
     // Compound Assignment Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4& operator+=(const Vector4& other) { w += other.w; x += other.x; y += other.y; z += other.z; return *this; }
+    constexpr Vector4& operator+=(const Vector4& other) requires std::is_arithmetic<T>::value { w += other.w; x += other.x; y += other.y; z += other.z; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4& operator-=(const Vector4& other) { w += other.w; x -= other.x; y -= other.y; z -= other.z; return *this; }
+    constexpr Vector4& operator-=(const Vector4& other) requires std::is_arithmetic<T>::value { w -= other.w; x -= other.x; y -= other.y; z -= other.z; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4& operator*=(T scalar) { w *= scalar; x *= scalar; y *= scalar; z *= scalar; return *this; }
+    constexpr Vector4& operator*=(T scalar) requires std::is_arithmetic<T>::value { w *= scalar; x *= scalar; y *= scalar; z *= scalar; return *this; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4& operator/=(T scalar) { w /= scalar; x /= scalar; y /= scalar; z /= scalar; return *this; }
+    constexpr Vector4& operator/=(T scalar) requires std::is_arithmetic<T>::value { w /= scalar; x /= scalar; y /= scalar; z /= scalar; return *this; }
 
     // Unary Operators
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    Vector4 operator-() { return Vector4{-w, -x, -y, -z}; }
+    constexpr Vector4 operator-() const requires std::is_arithmetic<T>::value { return Vector4{-w, -x, -y, -z}; }
 
     //methods
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-    T dot(const Vector4& other) const { return w * other.w + x * other.x + y * other.y + z * other.z; }
+    constexpr T dot(const Vector4& other) const requires std::is_arithmetic<T>::value { return w * other.w + x * other.x + y * other.y + z * other.z; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    T square_magnitude() const { return w*w + x*x + y*y + z*z; }
+    constexpr T square_magnitude() const requires std::is_arithmetic<T>::value { return w*w + x*x + y*y + z*z; }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    typename std::conditional<std::is_floating_point<T>::value, T, double>::type
-    magnitude() const { return std::sqrt(square_magnitude()); }
+    constexpr typename std::conditional<std::is_floating_point<T>::value, T, double>::type
+    magnitude() const requires std::is_arithmetic<T>::value {
+        using R = typename std::conditional<std::is_floating_point<T>::value, T, double>::type;
+        return math::sqrt(R(square_magnitude()));
+    }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    typename std::conditional<std::is_floating_point<T>::value, T, double>::type
-    distance(const Vector4& other) const { return (*this - other).magnitude(); }
+    constexpr typename std::conditional<std::is_floating_point<T>::value, T, double>::type
+    distance(const Vector4& other) const requires std::is_arithmetic<T>::value { return (*this - other).magnitude(); }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    Vector4 normalized() const {
+    constexpr Vector4 normalized() const requires std::is_arithmetic<T>::value {
         auto len = magnitude();
 
         if (len == 0) return {0, 0};
         return {T(w / len), T(x / len), T(y / len), T(z / len)};
     }
 
-    template<typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    void normalize() {
+    constexpr void normalize() requires std::is_arithmetic<T>::value {
         double len = magnitude();
 
         if (len == 0) return;
@@ -85,15 +73,30 @@ struct Vector4 {
         z /= len;
     }
 
-    template<typename U = T, typename = typename std::enable_if<std::is_floating_point<U>::value>::type>
-    bool same(const Vector4& other, T epsilon = epsilon_v<T>) const {
-        return std::abs(w - other.w) < epsilon &&
-               std::abs(x - other.x) < epsilon &&
-               std::abs(y - other.y) < epsilon &&
-               std::abs(z - other.z) < epsilon;
+    constexpr bool same(const Vector4& other, T epsilon = epsilon_v<T>) const requires std::is_floating_point<T>::value {
+        return math::abs(w - other.w) < epsilon &&
+               math::abs(x - other.x) < epsilon &&
+               math::abs(y - other.y) < epsilon &&
+               math::abs(z - other.z) < epsilon;
     }
 };
 
 using Vector4u = Vector4<std::uint32_t>;
 using Vector4i = Vector4<std::int32_t>;
 using Vector4f = Vector4<double>;
+
+// ---------- Hash ----------
+// Consistent with operator== (0.0 and -0.0 hash the same).
+template <typename T>
+struct std::hash<Vector4<T>> {
+    std::size_t operator()(const Vector4<T>& v) const {
+        return std::size_t(hashing::values(v.w, v.x, v.y, v.z));
+    }
+};
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template struct Vector4<std::uint32_t>;
+extern template struct Vector4<std::int32_t>;
+extern template struct Vector4<double>;
+#endif
@@ -0,0 +1,224 @@
+/**
+ * @file VectorArray.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Structure-of-arrays containers for Vector2/3/4 with batched SIMD kernels
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Simd.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+
+// ---------- Layout ----------
+// Lane order follows the member order of the AoS struct (Vector4 is w, x, y, z).
+template <typename V>
+struct VectorLayout {};
+
+template <typename T>
+struct VectorLayout<Vector2<T>> {
+    using value_type = T;
+    static constexpr std::size_t size = 2;
+    static constexpr T Vector2<T>::* members[size] = {&Vector2<T>::x, &Vector2<T>::y};
+};
+
+template <typename T>
+struct VectorLayout<Vector3<T>> {
+    using value_type = T;
+    static constexpr std::size_t size = 3;
+    static constexpr T Vector3<T>::* members[size] = {&Vector3<T>::x, &Vector3<T>::y, &Vector3<T>::z};
+};
+
+template <typename T>
+struct VectorLayout<Vector4<T>> {
+    using value_type = T;
+    static constexpr std::size_t size = 4;
+    static constexpr T Vector4<T>::* members[size] = {&Vector4<T>::w, &Vector4<T>::x, &Vector4<T>::y, &Vector4<T>::z};
+};
+
+/**
+ * @brief SoA batch of vectors: one aligned lane per component
+ *
+ * Kernels work on whole lanes with `simd::pack` and give the same results as calling
+ * the matching Vector method on every element (same operation order, true division).
+ * Kernels with another batch or an output span run over the shortest of them, like the pixel
+ * kernels; a VectorArray output is resized to that count.
+ *
+ * @tparam V Vector2<T>, Vector3<T> or Vector4<T>
+ */
+template <typename V>
+class VectorArray {
+    public:
+        using vector_type = V;
+        using value_type = typename VectorLayout<V>::value_type;
+        using lane_type = std::vector<value_type, simd::aligned_allocator<value_type>>;
+        static constexpr std::size_t components = VectorLayout<V>::size;
+
+        VectorArray() = default;
+        explicit VectorArray(std::size_t n) { resize(n); }
+        explicit VectorArray(std::span<const V> vectors) { gather(vectors); }
+
+        // ---------- Capacity ----------
+        std::size_t size() const { return _lanes[0].size(); }
+        bool empty() const { return _lanes[0].empty(); }
+
+        void resize(std::size_t n) { for (auto& lane : _lanes) lane.resize(n); }
+        void reserve(std::size_t n) { for (auto& lane : _lanes) lane.reserve(n); }
+        void clear() { for (auto& lane : _lanes) lane.clear(); }
+
+        // ---------- Lanes ----------
+        value_type* lane(std::size_t k) { return _lanes[k].data(); }
+        const value_type* lane(std::size_t k) const { return _lanes[k].data(); }
+
+        // ---------- Element access (AoS interop) ----------
+        V operator[](std::size_t i) const {
+            V v{};
+            for (std::size_t k = 0; k < components; ++k)
+                v.*VectorLayout<V>::members[k] = _lanes[k][i];
+            return v;
+        }
+
+        void set(std::size_t i, const V& v) {
+            for (std::size_t k = 0; k < components; ++k)
+                _lanes[k][i] = v.*VectorLayout<V>::members[k];
+        }
+
+        void push_back(const V& v) {
+            for (std::size_t k = 0; k < components; ++k)
+                _lanes[k].push_back(v.*VectorLayout<V>::members[k]);
+        }
+
+        // Replace the content with `vectors` (AoS -> SoA).
+        void gather(std::span<const V> vectors) {
+            resize(vectors.size());
+            for (std::size_t k = 0; k < components; ++k) {
+                value_type* dst = _lanes[k].data();
+                auto member = VectorLayout<V>::members[k];
+                for (std::size_t i = 0; i < vectors.size(); ++i)
+                    dst[i] = vectors[i].*member;
+            }
+        }
+
+        // Write the first min(size(), vectors.size()) elements into `vectors` (SoA -> AoS).
+        void scatter(std::span<V> vectors) const {
+            const std::size_t n = std::min(size(), vectors.size());
+            for (std::size_t k = 0; k < components; ++k) {
+                const value_type* src = _lanes[k].data();
+                auto member = VectorLayout<V>::members[k];
+                for (std::size_t i = 0; i < n; ++i)
+                    vectors[i].*member = src[i];
+            }
+        }
+
+        // ---------- Kernels ----------
+        // out[i] = (*this)[i].dot(other[i])
+        void dot(const VectorArray& other, std::span<value_type> out) const {
+            simd::for_each<value_type>(std::min({size(), other.size(), out.size()}), [&](auto p, std::size_t i) {
+                using P = decltype(p);
+                P acc = P::load(lane(0) + i) * P::load(other.lane(0) + i);
+                for (std::size_t k = 1; k < components; ++k)
+                    acc = acc + P::load(lane(k) + i) * P::load(other.lane(k) + i);
+                acc.store(out.data() + i);
+            });
+        }
+
+        // out[i] = (*this)[i].square_magnitude()
+        void square_magnitude(std::span<value_type> out) const { dot(*this, out); }
+
+        // out[i] = (*this)[i].cross(other[i]), Vector3 only
+        template <typename U = V, typename = typename std::enable_if<VectorLayout<U>::size == 3>::type>
+        void cross(const VectorArray& other, VectorArray& out) const {
+            const std::size_t n = std::min(size(), other.size());
+            out.resize(n);
+            simd::for_each<value_type>(n, [&](auto p, std::size_t i) {
+                using P = decltype(p);
+                P ax = P::load(lane(0) + i), ay = P::load(lane(1) + i), az = P::load(lane(2) + i);
+                P bx = P::load(other.lane(0) + i), by = P::load(other.lane(1) + i), bz = P::load(other.lane(2) + i);
+
+                (ay * bz - az * by).store(out.lane(0) + i);
+                (az * bx - ax * bz).store(out.lane(1) + i);
+                (ax * by - ay * bx).store(out.lane(2) + i);
+            });
+        }
+
+        // out[i] = (*this)[i].magnitude()
+        template <typename U = value_type, typename = typename std::enable_if<std::is_floating_point<U>::value>::type>
+        void magnitude(std::span<value_type> out) const {
+            simd::for_each<value_type>(std::min(size(), out.size()), [&](auto p, std::size_t i) {
+                sqrt(squareMagnitude(*this, p, i)).store(out.data() + i);
+            });
+        }
+
+        // out[i] = (*this)[i].distance(other[i])
+        template <typename U = value_type, typename = typename std::enable_if<std::is_floating_point<U>::value>::type>
+        void distance(const VectorArray& other, std::span<value_type> out) const {
+            simd::for_each<value_type>(std::min({size(), other.size(), out.size()}), [&](auto p, std::size_t i) {
+                using P = decltype(p);
+                P d = P::load(lane(0) + i) - P::load(other.lane(0) + i);
+                P acc = d * d;
+                for (std::size_t k = 1; k < components; ++k) {
+                    d = P::load(lane(k) + i) - P::load(other.lane(k) + i);
+                    acc = acc + d * d;
+                }
+                sqrt(acc).store(out.data() + i);
+            });
+        }
+
+        // out[i] = (*this)[i].normalized(), null vectors stay null
+        template <typename U = value_type, typename = typename std::enable_if<std::is_floating_point<U>::value>::type>
+        void normalized(VectorArray& out) const {
+            out.resize(size());
+            simd::for_each<value_type>(size(), [&](auto p, std::size_t i) {
+                using P = decltype(p);
+                P len = sqrt(squareMagnitude(*this, p, i));
+                auto nonNull = gt(len, P::broadcast(value_type(0)));
+
+                for (std::size_t k = 0; k < components; ++k)
+                    select(nonNull, P::load(lane(k) + i) / len, P::broadcast(value_type(0))).store(out.lane(k) + i);
+            });
+        }
+
+        template <typename U = value_type, typename = typename std::enable_if<std::is_floating_point<U>::value>::type>
+        void normalize() { normalized(*this); }
+
+    private:
+        template <typename P>
+        static P squareMagnitude(const VectorArray& a, P, std::size_t i) {
+            P v = P::load(a.lane(0) + i);
+            P acc = v * v;
+            for (std::size_t k = 1; k < components; ++k) {
+                v = P::load(a.lane(k) + i);
+                acc = acc + v * v;
+            }
+            return acc;
+        }
+
+        lane_type _lanes[components];
+};
+
+// ---------- Aliases ----------
+template <typename T>
+using Vector2Array = VectorArray<Vector2<T>>;
+
+template <typename T>
+using Vector3Array = VectorArray<Vector3<T>>;
+
+template <typename T>
+using Vector4Array = VectorArray<Vector4<T>>;
+
+// ---------- Explicit instantiations ----------
+#ifdef SYSTEM_EXTERN_TEMPLATES
+extern template class VectorArray<Vector2<float>>;
+extern template class VectorArray<Vector2<double>>;
+extern template class VectorArray<Vector3<float>>;
+extern template class VectorArray<Vector3<double>>;
+extern template class VectorArray<Vector4<float>>;
+extern template class VectorArray<Vector4<double>>;
+#endif
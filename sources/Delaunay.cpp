@@ -0,0 +1,10 @@
+/**
+ * @file Delaunay.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Explicit instantiations of the Delaunay triangulation for the shipped types
+ * @date 2026-10-18
+ */
+
+#include "Delaunay.hpp"
+
+template class Delaunay<double>;
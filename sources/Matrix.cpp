@@ -0,0 +1,11 @@
+/**
+ * @file Matrix.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Explicit instantiations of the matrix templates for the shipped types
+ * @date 2026-10-18
+ */
+
+#include "Matrix.hpp"
+
+template struct Matrix<double, 3, 3>;
+template struct Matrix<double, 4, 4>;
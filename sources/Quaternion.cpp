@@ -0,0 +1,11 @@
+/**
+ * @file Quaternion.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Explicit instantiations of the quaternion templates for the shipped types
+ * @date 2026-10-18
+ */
+
+#include "Quaternion.hpp"
+
+template class Quaternion<float>;
+template class Quaternion<double>;
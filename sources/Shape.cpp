@@ -0,0 +1,18 @@
+/**
+ * @file Shape.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Explicit instantiations of the shape templates for the shipped types
+ * @date 2026-10-18
+ */
+
+#include "Shape.hpp"
+
+template struct Rect<std::uint32_t>;
+template struct Rect<std::int32_t>;
+template struct Rect<double>;
+template struct Line<std::uint32_t>;
+template struct Line<std::int32_t>;
+template struct Line<double>;
+template struct Triangle<std::uint32_t>;
+template struct Triangle<std::int32_t>;
+template struct Triangle<double>;
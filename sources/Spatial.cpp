@@ -0,0 +1,20 @@
+/**
+ * @file Spatial.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Explicit instantiations of the spatial structures for the shipped types
+ * @date 2026-10-18
+ */
+
+#include "AabbTree.hpp"
+#include "KdTree.hpp"
+#include "PointLocation.hpp"
+#include "SegmentIntersector.hpp"
+#include "SpatialGrid.hpp"
+#include "SweepAndPrune.hpp"
+
+template class AabbTree<double>;
+template class KdTree<double>;
+template class SpatialGrid<double>;
+template class SweepAndPrune<double>;
+template class SegmentIntersector<double>;
+template class TriangleLocator<double>;
@@ -0,0 +1,10 @@
+/**
+ * @file TransformHierarchy.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Explicit instantiations of the transform hierarchy for the shipped types
+ * @date 2026-10-18
+ */
+
+#include "TransformHierarchy.hpp"
+
+template class TransformHierarchy<double>;
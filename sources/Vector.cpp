@@ -0,0 +1,27 @@
+/**
+ * @file Vector.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Explicit instantiations of the vector and SoA vector batch templates for the shipped types
+ * @date 2026-10-18
+ */
+
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+#include "VectorArray.hpp"
+
+template struct Vector2<std::uint32_t>;
+template struct Vector2<std::int32_t>;
+template struct Vector2<double>;
+template struct Vector3<std::uint32_t>;
+template struct Vector3<std::int32_t>;
+template struct Vector3<double>;
+template struct Vector4<std::uint32_t>;
+template struct Vector4<std::int32_t>;
+template struct Vector4<double>;
+template class VectorArray<Vector2<float>>;
+template class VectorArray<Vector2<double>>;
+template class VectorArray<Vector3<float>>;
+template class VectorArray<Vector3<double>>;
+template class VectorArray<Vector4<float>>;
+template class VectorArray<Vector4<double>>;
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+#include "common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<std::uint32_t> queryData(const AabbTree<double>& tree, const Rectf& region) {
+        std::vector<std::uint32_t> found;
+        tree.query(region, [&](AabbTree<double>::Proxy p) {
+            found.push_back(tree.data(p));
+            return true;
+        });
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+
+    // Fraction of the first hit of p1 + t (p2 - p1) on `r`, or -1.
+    double rayHit(const Rectf& r, Vector2f p1, Vector2f p2) {
+        double tmin = 0.0, tmax = 1.0;
+        const double o[2] = {p1.x, p1.y}, d[2] = {p2.x - p1.x, p2.y - p1.y};
+        const double lo[2] = {r.x - r.w / 2, r.y - r.h / 2}, hi[2] = {r.x + r.w / 2, r.y + r.h / 2};
+        for (int k = 0; k < 2; ++k) {
+            if (d[k] == 0.0) {
+                if (o[k] < lo[k] || o[k] > hi[k])
+                    return -1.0;
+                continue;
+            }
+            double t1 = (lo[k] - o[k]) / d[k], t2 = (hi[k] - o[k]) / d[k];
+            if (t1 > t2)
+                std::swap(t1, t2);
+            tmin = std::max(tmin, t1);
+            tmax = std::min(tmax, t2);
+            if (tmin > tmax)
+                return -1.0;
+        }
+        return tmin;
+    }
+}
+
+TEST(AabbTreeTest, InsertQuery) {
+    auto rects = test::rects(3000, 1);
+    AabbTree<double> tree(0.1);
+    for (std::uint32_t i = 0; i < rects.size(); ++i)
+        tree.insert(rects[i], i);
+
+    EXPECT_EQ(tree.size(), rects.size());
+    EXPECT_TRUE(tree.validate());
+    EXPECT_LE(tree.height(), 2 * int(std::log2(double(rects.size()))));
+
+    // every rect overlapping the region is reported (fat boxes give a superset)
+    const Rectf region{50, 50, 10, 6};
+    const auto found = queryData(tree, region);
+    for (std::uint32_t i = 0; i < rects.size(); ++i) {
+        if (rects[i].intersects(region)) {
+            EXPECT_TRUE(std::binary_search(found.begin(), found.end(), i)) << i;
+        }
+    }
+    for (std::uint32_t i : found)
+        EXPECT_TRUE(rects[i].intersects(region, 0.1));
+}
+
+TEST(AabbTreeTest, QueryStops) {
+    auto rects = test::rects(100, 2);
+    AabbTree<double> tree;
+    for (std::uint32_t i = 0; i < rects.size(); ++i)
+        tree.insert(rects[i], i);
+
+    int calls = 0;
+    tree.query(Rectf{50, 50, 200, 200}, [&](AabbTree<double>::Proxy) { return ++calls < 3; });
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(AabbTreeTest, RemoveAndReuse) {
+    auto rects = test::rects(1000, 3);
+    AabbTree<double> tree(0.1);
+    std::vector<AabbTree<double>::Proxy> proxies;
+    for (std::uint32_t i = 0; i < rects.size(); ++i)
+        proxies.push_back(tree.insert(rects[i], i));
+
+    for (std::size_t i = 0; i < rects.size(); i += 2)
+        tree.remove(proxies[i]);
+    EXPECT_EQ(tree.size(), rects.size() / 2);
+    EXPECT_TRUE(tree.validate());
+
+    const auto found = queryData(tree, Rectf{50, 50, 200, 200});
+    ASSERT_EQ(found.size(), rects.size() / 2);
+    for (std::uint32_t i : found)
+        EXPECT_EQ(i % 2, 1u);
+
+    // freed nodes are recycled
+    for (std::size_t i = 0; i < rects.size(); i += 2)
+        tree.insert(rects[i], std::uint32_t(i));
+    EXPECT_EQ(tree.size(), rects.size());
+    EXPECT_TRUE(tree.validate());
+
+    for (auto p : proxies)
+        if (tree.data(p) % 2 == 1)
+            tree.remove(p);
+    EXPECT_EQ(tree.size(), rects.size() / 2);
+    EXPECT_TRUE(tree.validate());
+}
+
+TEST(AabbTreeTest, Rebuild) {
+    auto rects = test::rects(3000, 9);
+    AabbTree<double> tree(0.1);
+    std::vector<AabbTree<double>::Proxy> proxies;
+    for (std::uint32_t i = 0; i < rects.size(); ++i)
+        proxies.push_back(tree.insert(rects[i], i));
+
+    const Rectf region{30, 60, 12, 8};
+    const auto before = queryData(tree, region);
+    const Rectf fat = tree.fatRect(proxies[17]);
+
+    tree.rebuild();
+    EXPECT_TRUE(tree.validate());
+    EXPECT_EQ(tree.size(), rects.size());
+    EXPECT_EQ(queryData(tree, region), before);
+    EXPECT_EQ(tree.fatRect(proxies[17]).x, fat.x);
+    EXPECT_EQ(tree.fatRect(proxies[17]).w, fat.w);
+
+    // still a regular dynamic tree afterwards
+    for (std::size_t i = 0; i < proxies.size(); i += 3)
+        tree.remove(proxies[i]);
+    tree.move(proxies[1], Rectf{-50, -50, 1, 1});
+    EXPECT_TRUE(tree.validate());
+    EXPECT_EQ(queryData(tree, Rectf{-50, -50, 2, 2}), std::vector<std::uint32_t>{1});
+
+    AabbTree<double> empty;
+    empty.rebuild();
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST(AabbTreeTest, Move) {
+    AabbTree<double> tree(0.5);
+    const auto p = tree.insert(Rectf{0, 0, 1, 1});
+    tree.insert(Rectf{10, 10, 1, 1});
+
+    // small motions stay inside the fat box
+    EXPECT_FALSE(tree.move(p, Rectf{0.2, -0.3, 1, 1}));
+    EXPECT_TRUE(tree.move(p, Rectf{3, 0, 1, 1}, Vector2f{1, 0}));
+    // stretched ahead of the motion: 0.5 margin + 4 * 1 displacement
+    Rectf fat = tree.fatRect(p);
+    EXPECT_DOUBLE_EQ(fat.x - fat.w / 2, 2.0);
+    EXPECT_DOUBLE_EQ(fat.x + fat.w / 2, 8.0);
+    EXPECT_FALSE(tree.move(p, Rectf{5, 0, 1, 1}, Vector2f{1, 0}));
+    // far from the last prediction: the fat box would be too large, it is rebuilt
+    EXPECT_TRUE(tree.move(p, Rectf{7, 0, 1, 1}));
+    EXPECT_TRUE(tree.validate());
+}
+
+TEST(AabbTreeTest, MovingCrowd) {
+    auto rects = test::rects(2000, 4);
+    AabbTree<double> tree(0.2);
+    std::vector<AabbTree<double>::Proxy> proxies;
+    for (std::uint32_t i = 0; i < rects.size(); ++i)
+        proxies.push_back(tree.insert(rects[i], i));
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> step(-0.3, 0.3);
+    for (int frame = 0; frame < 20; ++frame)
+        for (std::size_t i = 0; i < rects.size(); ++i) {
+            const Vector2f d{step(rng), step(rng)};
+            rects[i].x += d.x;
+            rects[i].y += d.y;
+            tree.move(proxies[i], rects[i], d);
+        }
+    ASSERT_TRUE(tree.validate());
+
+    for (std::size_t i = 0; i < rects.size(); ++i) {
+        const Rectf fat = tree.fatRect(proxies[i]);
+        EXPECT_LE(fat.x - fat.w / 2, rects[i].x - rects[i].w / 2);
+        EXPECT_GE(fat.x + fat.w / 2, rects[i].x + rects[i].w / 2);
+    }
+    const Rectf region{30, 70, 15, 15};
+    const auto found = queryData(tree, region);
+    for (std::uint32_t i = 0; i < rects.size(); ++i) {
+        if (rects[i].intersects(region)) {
+            EXPECT_TRUE(std::binary_search(found.begin(), found.end(), i)) << i;
+        }
+    }
+}
+
+TEST(AabbTreeTest, RayCastClosest) {
+    auto rects = test::rects(2000, 6);
+    AabbTree<double> tree(0.1);
+    for (std::uint32_t i = 0; i < rects.size(); ++i)
+        tree.insert(rects[i], i);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> pos(-10.0, 110.0);
+    for (int ray = 0; ray < 50; ++ray) {
+        const Vector2f p1{pos(rng), pos(rng)}, p2{pos(rng), pos(rng)};
+
+        double expected = -1.0;
+        for (const auto& r : rects) {
+            const double t = rayHit(r, p1, p2);
+            if (t >= 0.0 && (expected < 0.0 || t < expected))
+                expected = t;
+        }
+
+        double best = -1.0;
+        tree.rayCast(p1, p2, [&](AabbTree<double>::Proxy p, double maxFraction) {
+            const double t = rayHit(rects[tree.data(p)], p1, p2);
+            if (t < 0.0 || t > maxFraction)
+                return -1.0;
+            best = t;
+            return t;
+        });
+        EXPECT_DOUBLE_EQ(best, expected) << ray;
+    }
+}
+
+TEST(AabbTreeTest, Integer) {
+    AabbTree<int> tree(1);
+    for (int i = 0; i < 100; ++i)
+        tree.insert(Recti{i * 4, (i % 10) * 4, 2, 2}, std::uint32_t(i));
+    EXPECT_TRUE(tree.validate());
+
+    int count = 0;
+    tree.query(Recti{0, 0, 2, 2}, [&](AabbTree<int>::Proxy) { return ++count, true; });
+    EXPECT_GE(count, 1);
+}
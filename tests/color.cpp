@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include "Type.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
 // ---------- Color ----------
 TEST(ColorTest, DefaultInitialization) {
     Color c{};
@@ -16,4 +20,106 @@ TEST(ColorTest, Assignment) {
     EXPECT_EQ(c.g, 128);
     EXPECT_EQ(c.b, 64);
     EXPECT_EQ(c.a, 32);
-}
\ No newline at end of file
+}
+
+// ---------- sRGB ----------
+TEST(ColorTest, SrgbDecode) {
+    EXPECT_EQ(srgb::decode(0), 0.0f);
+    EXPECT_EQ(srgb::decode(255), 1.0f);
+    auto reference = [](double c) { return c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4); };
+    for (int c = 0; c < 256; ++c) {
+        EXPECT_NEAR(srgb::decode(std::uint8_t(c)), reference(c / 255.0), 1e-7);
+        EXPECT_EQ(srgb::encode(srgb::decode(std::uint8_t(c))), c);
+    }
+    // the tables are compile time constants
+    static_assert(srgb::detail::decodeTable[255] == 1.0f);
+    static_assert(srgb::toLinear(0.5) > 0.2140 && srgb::toLinear(0.5) < 0.2141);
+}
+
+TEST(ColorTest, SrgbEncode) {
+    // every float near a decision threshold, and a sweep, against the pow reference
+    auto reference = [](float v) { return int(std::lround(srgb::toSrgb(double(v)) * 255.0)); };
+    for (int k = 1; k < 256; ++k) {
+        const float t = float(srgb::toLinear((k - 0.5) / 255.0));
+        float v = t;
+        for (int step = 0; step < 4; ++step)
+            v = std::nextafter(v, 0.0f);
+        for (int step = 0; step < 8; ++step, v = std::nextafter(v, 1.0f))
+            EXPECT_EQ(srgb::encode(v), reference(v)) << "v = " << v;
+    }
+    for (int i = 0; i <= 100000; ++i) {
+        const float v = float(i) / 100000.0f;
+        EXPECT_EQ(srgb::encode(v), reference(v)) << "v = " << v;
+    }
+    EXPECT_EQ(srgb::encode(-1.0f), 0);
+    EXPECT_EQ(srgb::encode(2.0f), 255);
+    EXPECT_EQ(srgb::encode(std::nanf("")), 0);
+}
+
+TEST(ColorTest, SrgbSpans) {
+    std::vector<Color> px;
+    for (int i = 0; i < 256; ++i)
+        px.push_back({std::uint8_t(i), std::uint8_t(255 - i), std::uint8_t(i * 7), std::uint8_t(i / 2)});
+    std::vector<Vector4<float>> linear(px.size());
+    srgb::decode(px, linear);
+    EXPECT_EQ(linear[3].x, srgb::decode(3));
+    EXPECT_EQ(linear[3].y, srgb::decode(252));
+    EXPECT_FLOAT_EQ(linear[3].w, 1.0f / 255.0f);
+
+    std::vector<Color> back(px.size());
+    srgb::encode(linear, back);
+    EXPECT_EQ(back, px);
+}
+
+// ---------- HSV / HSL ----------
+TEST(ColorTest, Hsv) {
+    const Hsv red = toHsv(Color{255, 0, 0, 255});
+    EXPECT_FLOAT_EQ(red.h, 0.0f);
+    EXPECT_FLOAT_EQ(red.s, 1.0f);
+    EXPECT_FLOAT_EQ(red.v, 1.0f);
+    EXPECT_FLOAT_EQ(red.a, 1.0f);
+    EXPECT_FLOAT_EQ(toHsv(Color{0, 255, 0, 0}).h, 120.0f);
+    EXPECT_FLOAT_EQ(toHsv(Color{0, 0, 255, 0}).h, 240.0f);
+    EXPECT_FLOAT_EQ(toHsv(Color{255, 0, 255, 0}).h, 300.0f);
+    EXPECT_FLOAT_EQ(toHsv(Color{128, 128, 128, 0}).s, 0.0f);
+
+    EXPECT_EQ(fromHsv(Hsv{60.0f, 1.0f, 1.0f, 1.0f}), (Color{255, 255, 0, 255}));
+    EXPECT_EQ(fromHsv(Hsv{420.0f, 1.0f, 1.0f, 1.0f}), (Color{255, 255, 0, 255}));
+    EXPECT_EQ(fromHsv(Hsv{-300.0f, 1.0f, 1.0f, 1.0f}), (Color{255, 255, 0, 255}));
+    EXPECT_EQ(fromHsv(Hsv{180.0f, 0.5f, 0.5f, 0.0f}), (Color{64, 128, 128, 0}));
+}
+
+TEST(ColorTest, Hsl) {
+    const Hsl red = toHsl(Color{255, 0, 0, 255});
+    EXPECT_FLOAT_EQ(red.h, 0.0f);
+    EXPECT_FLOAT_EQ(red.s, 1.0f);
+    EXPECT_FLOAT_EQ(red.l, 0.5f);
+    EXPECT_FLOAT_EQ(toHsl(Color{255, 255, 255, 0}).s, 0.0f);
+    EXPECT_FLOAT_EQ(toHsl(Color{255, 255, 255, 0}).l, 1.0f);
+
+    EXPECT_EQ(fromHsl(Hsl{240.0f, 1.0f, 0.5f, 1.0f}), (Color{0, 0, 255, 255}));
+    EXPECT_EQ(fromHsl(Hsl{120.0f, 1.0f, 0.25f, 1.0f}), (Color{0, 128, 0, 255}));
+    EXPECT_EQ(fromHsl(Hsl{0.0f, 0.0f, 0.5f, 1.0f}), (Color{128, 128, 128, 255}));
+}
+
+TEST(ColorTest, HsvHslRoundTrip) {
+    std::vector<Color> px;
+    for (int r = 0; r < 256; r += 5)
+        for (int g = 0; g < 256; g += 7)
+            for (int b = 0; b < 256; b += 11)
+                px.push_back({std::uint8_t(r), std::uint8_t(g), std::uint8_t(b), std::uint8_t(r ^ g)});
+
+    std::vector<Hsv> hsv(px.size());
+    std::vector<Hsl> hsl(px.size());
+    std::vector<Color> back(px.size());
+    toHsv(px, hsv);
+    fromHsv(hsv, back);
+    EXPECT_EQ(back, px);
+    toHsl(px, hsl);
+    fromHsl(hsl, back);
+    EXPECT_EQ(back, px);
+    for (std::size_t i = 0; i < px.size(); i += 97) {
+        EXPECT_EQ(hsv[i].h, toHsv(px[i]).h);
+        EXPECT_EQ(hsl[i].s, toHsl(px[i]).s);
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file common.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Seeded random inputs shared by the tests
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <random>
+#include <vector>
+
+#include "Type.hpp"
+
+namespace test {
+
+    // n points uniform in [lo, hi) x [lo, hi).
+    inline std::vector<Vector2f> points2(std::size_t n, unsigned seed, double lo = -10.0, double hi = 10.0) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> u(lo, hi);
+        std::vector<Vector2f> points(n);
+        for (auto& p : points)
+            p = {u(rng), u(rng)};
+        return points;
+    }
+
+    // n points uniform in the box [-extent, extent).
+    inline std::vector<Vector3f> points3(std::size_t n, unsigned seed, const Vector3f& extent = {1.0, 1.0, 1.0}) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        std::vector<Vector3f> points(n);
+        for (auto& p : points)
+            p = {extent.x * u(rng), extent.y * u(rng), extent.z * u(rng)};
+        return points;
+    }
+
+    // n rects, corner uniform in [lo, hi) x [lo, hi), width and height uniform in [minSize, maxSize).
+    inline std::vector<Rectf> rects(std::size_t n, unsigned seed, double lo = 0.0, double hi = 100.0,
+                                    double minSize = 0.2, double maxSize = 3.0) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> pos(lo, hi), size(minSize, maxSize);
+        std::vector<Rectf> rects(n);
+        for (auto& r : rects)
+            r = {pos(rng), pos(rng), size(rng), size(rng)};
+        return rects;
+    }
+
+} // namespace test
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <array>
+#include <cmath>
+
+namespace {
+    constexpr bool near(double a, double b, double tolerance = 1e-15) { return math::abs(a - b) <= tolerance; }
+
+    constexpr bool equal(const Matrix4x4& a, const Matrix4x4& b) {
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                if (a(i, j) != b(i, j))
+                    return false;
+        return true;
+    }
+
+    constexpr std::size_t steps = 16;
+
+    // rotation matrices around z for k / steps of a turn, folded at compile time
+    constexpr std::array<Matrix4x4, steps> makeRotations() {
+        std::array<Matrix4x4, steps> table{};
+        for (std::size_t k = 0; k < steps; ++k)
+            table[k] = Quaterniond::fromAxisAngle(2.0 * math::pi * double(k) / double(steps), {0, 0, 1}).toMatrix();
+        return table;
+    }
+
+    constexpr std::array<Matrix4x4, steps> rotations = makeRotations();
+}
+
+// ---------- Math ----------
+TEST(ConstexprTest, MathFunctions) {
+    static_assert(math::sqrt(25.0) == 5.0);
+    static_assert(math::sqrt(0.0) == 0.0);
+    static_assert(near(math::sqrt(2.0) * math::sqrt(2.0), 2.0, 1e-15));
+    static_assert(math::sqrt(1e-300) > 0.0);
+    static_assert(math::sin(0.0) == 0.0 && math::cos(0.0) == 1.0);
+    static_assert(near(math::sin(math::pi / 6.0), 0.5));
+    static_assert(near(math::cos(math::pi / 3.0), 0.5));
+    static_assert(near(math::sin(-3.0 * math::pi / 2.0), 1.0));
+
+    // compile time results against <cmath>
+    static constexpr double angles[] = {-7.5, -2.0, -0.3, 0.1, 0.785, 1.6, 3.14, 4.0, 12.25};
+    constexpr std::array<double, 9> sines = [] {
+        std::array<double, 9> r{};
+        for (std::size_t i = 0; i < 9; ++i)
+            r[i] = math::sin(angles[i]);
+        return r;
+    }();
+    constexpr std::array<double, 9> cosines = [] {
+        std::array<double, 9> r{};
+        for (std::size_t i = 0; i < 9; ++i)
+            r[i] = math::cos(angles[i]);
+        return r;
+    }();
+    for (std::size_t i = 0; i < 9; ++i) {
+        EXPECT_NEAR(sines[i], std::sin(angles[i]), 4e-16);
+        EXPECT_NEAR(cosines[i], std::cos(angles[i]), 4e-16);
+    }
+
+    constexpr std::array<double, 5> roots = {math::sqrt(0.5), math::sqrt(3.0), math::sqrt(1e10), math::sqrt(7e-9), math::sqrt(123456.789)};
+    EXPECT_EQ(roots[0], std::sqrt(0.5));
+    EXPECT_EQ(roots[1], std::sqrt(3.0));
+    EXPECT_EQ(roots[2], std::sqrt(1e10));
+    EXPECT_EQ(roots[3], std::sqrt(7e-9));
+    EXPECT_EQ(roots[4], std::sqrt(123456.789));
+}
+
+// ---------- Vector ----------
+TEST(ConstexprTest, Vectors) {
+    constexpr Vector3f a = {1, 2, 3};
+    constexpr Vector3f b = {4, -5, 6};
+    static_assert(a.dot(b) == 12.0);
+    static_assert(a.cross(b) == Vector3f{27, 6, -13});
+    static_assert(Vector3f{3, 0, 4}.magnitude() == 5.0);
+    static_assert((a + b - a * 2.0) / 2.0 == Vector3f{1.5, -3.5, 1.5});
+    static_assert(Vector2f{3, 4}.normalized().same({0.6, 0.8}));
+
+    constexpr Vector4f c = [] {
+        Vector4f v = {1, 2, 3, 4};
+        v -= Vector4f{1, 1, 1, 1};
+        return -v;
+    }();
+    static_assert(c == Vector4f{0, -1, -2, -3});
+    SUCCEED();
+}
+
+// ---------- Matrix ----------
+TEST(ConstexprTest, Matrices) {
+    constexpr Matrix4x4 identity = Matrix4x4::identity();
+    constexpr Matrix4x4 d = Matrix4x4::diagonal({1, 2, 3, 4});
+    constexpr Matrix4x4 m = {{{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16}}};
+
+    static_assert(equal(identity * m, m));
+    static_assert(equal(m.transpose().transpose(), m));
+    static_assert(m.transpose()(0, 3) == 13);
+    static_assert((d * m)(2, 1) == 30);
+    static_assert((m * d)(2, 1) == 20);
+    static_assert(equal(m + m - m * 2.0, Matrix4x4::zero()));
+    static_assert((m * Vector4f{1, 1, 1, 1}).w == 58);
+
+    // the constexpr path (reference loops) and the run time kernels agree
+    Matrix4x4 runtime = m;
+    EXPECT_TRUE(equal(runtime * d, m * d));
+    EXPECT_TRUE(equal(runtime.transpose(), m.transpose()));
+}
+
+// ---------- Quaternion ----------
+TEST(ConstexprTest, RotationTable) {
+    static_assert(near(rotations[0](0, 0), 1.0));
+    static_assert(near(rotations[4](0, 1), -1.0));
+    static_assert(near(rotations[4](1, 0), 1.0));
+    static_assert(near(rotations[8](0, 0), -1.0));
+    static_assert(near((rotations[3] * rotations[5])(0, 0), rotations[8](0, 0)));
+
+    constexpr Vector3f p = transformPoint(rotations[4], Vector3f{1, 0, 0});
+    static_assert(p.same({0, 1, 0}, 1e-15));
+
+    constexpr Quaterniond q = [] {
+        Quaterniond r = Quaterniond::fromEulerAngles(0.3, -0.2, 1.1) * Quaterniond(2, 0, 0, 0);
+        r.normalize();
+        return r;
+    }();
+    static_assert(near(q.dot(q), 1.0));
+    static_assert(Quaterniond::fromAxisAngle(math::pi / 2.0, {0, 0, 1}).rotate({1, 0, 0}).same({0, 1, 0}, 1e-15));
+
+    for (std::size_t k = 0; k < steps; ++k) {
+        const Matrix4x4 expected = Quaterniond::fromAxisAngle(2.0 * M_PI * double(k) / double(steps), {0, 0, 1}).toMatrix();
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                EXPECT_NEAR(rotations[k](i, j), expected(i, j), 1e-15);
+    }
+}
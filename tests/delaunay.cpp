@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+#include "common.hpp"
+
+#include <map>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+    double orient(const Vector2f& a, const Vector2f& b, const Vector2f& c) {
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    }
+
+    double incircle(const Vector2f& a, const Vector2f& b, const Vector2f& c, const Vector2f& d) {
+        const double adx = a.x - d.x, ady = a.y - d.y;
+        const double bdx = b.x - d.x, bdy = b.y - d.y;
+        const double cdx = c.x - d.x, cdy = c.y - d.y;
+        return (adx * adx + ady * ady) * (bdx * cdy - cdx * bdy)
+             + (bdx * bdx + bdy * bdy) * (cdx * ady - adx * cdy)
+             + (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady);
+    }
+
+    // Number of directed edges without a twin, i.e. hull edges.
+    std::size_t hullEdges(std::span<const Delaunay<double>::Face> faces) {
+        std::map<std::pair<std::uint32_t, std::uint32_t>, int> edges;
+        for (const auto& f : faces)
+            for (std::size_t i = 0; i < 3; ++i)
+                ++edges[{f[i], f[(i + 1) % 3]}];
+
+        std::size_t hull = 0;
+        for (const auto& [e, count] : edges) {
+            EXPECT_EQ(count, 1);
+            hull += edges.count({e.second, e.first}) == 0;
+        }
+        return hull;
+    }
+}
+
+TEST(DelaunayTest, Square) {
+    std::vector<Vector2f> points = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    Delaunay<double> d(points);
+
+    ASSERT_EQ(d.indices().size(), 2u);
+    for (const auto& t : d.triangles())
+        EXPECT_GT(orient(t.p1, t.p2, t.p3), 0.0);
+}
+
+TEST(DelaunayTest, Degenerate) {
+    std::vector<Vector2f> line = {{0, 0}, {1, 1}, {2, 2}, {3, 3}};
+    EXPECT_TRUE(Delaunay<double>(line).indices().empty());
+
+    std::vector<Vector2f> two = {{0, 0}, {1, 0}};
+    EXPECT_TRUE(Delaunay<double>(two).indices().empty());
+}
+
+TEST(DelaunayTest, Duplicates) {
+    std::vector<Vector2f> points = {{0, 0}, {0, 0}, {1, 0}, {1, 0}, {0, 1}, {0, 0}};
+    Delaunay<double> d(points);
+    EXPECT_EQ(d.indices().size(), 1u);
+}
+
+TEST(DelaunayTest, IntegerGrid) {
+    std::vector<Vector2i> grid;
+    for (int i = 0; i < 10; ++i)
+        for (int j = 0; j < 10; ++j)
+            grid.push_back({i, j});
+
+    // 2n - h - 2 triangles with 36 points on the hull (collinear points included)
+    Delaunay<int> d(grid);
+    EXPECT_EQ(d.indices().size(), 2u * 100 - 36 - 2);
+}
+
+TEST(DelaunayTest, EmptyCircumcircle) {
+    std::vector<Vector2f> points = test::points2(800, 1);
+    Delaunay<double> d(points);
+
+    const auto& faces = d.indices();
+    EXPECT_EQ(faces.size(), 2 * points.size() - hullEdges(faces) - 2);
+
+    for (const auto& f : faces) {
+        ASSERT_GT(orient(points[f[0]], points[f[1]], points[f[2]]), 0.0);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            if (i == f[0] || i == f[1] || i == f[2])
+                continue;
+            EXPECT_LE(incircle(points[f[0]], points[f[1]], points[f[2]], points[i]), 1e-9);
+        }
+    }
+}
+
+TEST(DelaunayTest, Reuse) {
+    Delaunay<double> d;
+    std::vector<Vector2f> big = test::points2(5000, 2);
+    d.triangulate(big);
+    EXPECT_EQ(d.indices().size(), 2 * big.size() - hullEdges(d.indices()) - 2);
+
+    std::vector<Vector2f> small = test::points2(50, 3);
+    d.triangulate(small);
+    EXPECT_EQ(d.indices().size(), 2 * small.size() - hullEdges(d.indices()) - 2);
+}
+
+TEST(DelaunayTest, OutlivesInput) {
+    const std::vector<Vector2<int>> points = {{0, 0}, {4, 0}, {4, 3}, {0, 3}, {2, 1}};
+    Delaunay<int> d;
+    {
+        std::vector<Vector2<int>> input = points;
+        d.triangulate(input);
+        input.assign(input.size(), {-7, -7});
+    }
+    const auto triangles = d.triangles();
+    ASSERT_EQ(triangles.size(), d.indices().size());
+    for (std::size_t k = 0; k < triangles.size(); ++k) {
+        EXPECT_EQ(triangles[k].p1, points[d.indices()[k][0]]);
+        EXPECT_EQ(triangles[k].p2, points[d.indices()[k][1]]);
+        EXPECT_EQ(triangles[k].p3, points[d.indices()[k][2]]);
+    }
+}
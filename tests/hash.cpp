@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+TEST(HashTest, Canonical) {
+    const Linef l{{3.0, 1.0}, {1.0, 5.0}};
+    EXPECT_EQ(l.canonical().p1, (Vector2f{1.0, 5.0}));
+    EXPECT_EQ(l.canonical().p2, (Vector2f{3.0, 1.0}));
+    EXPECT_EQ(l.canonical().canonical().p1, l.canonical().p1);
+
+    const Trianglef t{{2.0, 0.0}, {0.0, 1.0}, {0.0, -1.0}};
+    const Trianglef c = t.canonical();
+    EXPECT_EQ(c.p1, (Vector2f{0.0, -1.0}));
+    EXPECT_EQ(c.p2, (Vector2f{0.0, 1.0}));
+    EXPECT_EQ(c.p3, (Vector2f{2.0, 0.0}));
+
+    // every permutation has the same canonical form and compares equal
+    const Vector2f v[3] = {t.p1, t.p2, t.p3};
+    const int perms[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    for (const auto& p : perms) {
+        const Trianglef u{v[p[0]], v[p[1]], v[p[2]]};
+        EXPECT_EQ(u.canonical().p1, c.p1);
+        EXPECT_EQ(u.canonical().p2, c.p2);
+        EXPECT_EQ(u.canonical().p3, c.p3);
+        EXPECT_TRUE(u == t);
+        EXPECT_EQ(std::hash<Trianglef>{}(u), std::hash<Trianglef>{}(t));
+    }
+    EXPECT_FALSE(t == (Trianglef{{2.0, 0.0}, {0.0, 1.0}, {0.0, -2.0}}));
+    EXPECT_FALSE((Trianglef{{0.0, 0.0}, {0.0, 0.0}, {1.0, 1.0}}) == (Trianglef{{0.0, 0.0}, {1.0, 1.0}, {1.0, 1.0}}));
+}
+
+TEST(HashTest, ConsistentWithEquality) {
+    EXPECT_EQ(std::hash<Vector2f>{}({0.0, -0.0}), std::hash<Vector2f>{}({-0.0, 0.0}));
+    EXPECT_EQ(std::hash<Vector3f>{}({-0.0, 1.0, 2.0}), std::hash<Vector3f>{}({0.0, 1.0, 2.0}));
+    EXPECT_EQ(std::hash<Vector4f>{}({1.0, -0.0, 2.0, 3.0}), std::hash<Vector4f>{}({1.0, 0.0, 2.0, 3.0}));
+    EXPECT_EQ(std::hash<Linef>{}({{1.0, 2.0}, {3.0, 4.0}}), std::hash<Linef>{}({{3.0, 4.0}, {1.0, 2.0}}));
+
+    // member order matters for vectors
+    EXPECT_NE(std::hash<Vector2i>{}({1, 2}), std::hash<Vector2i>{}({2, 1}));
+    EXPECT_NE(std::hash<Vector3i>{}({1, 2, 3}), std::hash<Vector3i>{}({3, 2, 1}));
+    EXPECT_NE(std::hash<Color>{}({1, 2, 3, 4}), std::hash<Color>{}({4, 3, 2, 1}));
+    EXPECT_TRUE((Color{1, 2, 3, 4} == Color{1, 2, 3, 4}));
+
+    // usable by the standard containers
+    std::unordered_set<Linei> edges{{{0, 0}, {1, 0}}, {{1, 0}, {0, 0}}, {{0, 0}, {0, 1}}};
+    EXPECT_EQ(edges.size(), 2u);
+    std::unordered_set<Color> colors{{1, 2, 3, 4}, {1, 2, 3, 4}, {0, 0, 0, 255}};
+    EXPECT_EQ(colors.size(), 2u);
+}
+
+TEST(HashTest, FlatSetMatchesUnorderedSet) {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> coord(0, 40), op(0, 3);
+    FlatSet<Vector2i> flat;
+    std::unordered_set<Vector2i> reference;
+
+    for (int i = 0; i < 20000; ++i) {
+        const Vector2i v{coord(rng), coord(rng)};
+        if (op(rng) == 0) {
+            EXPECT_EQ(flat.erase(v), reference.erase(v) == 1);
+        } else {
+            EXPECT_EQ(flat.insert(v), reference.insert(v).second);
+        }
+        ASSERT_EQ(flat.size(), reference.size());
+    }
+    for (int y = 0; y <= 40; ++y)
+        for (int x = 0; x <= 40; ++x)
+            EXPECT_EQ(flat.contains({x, y}), reference.count({x, y}) == 1);
+
+    std::size_t visited = 0;
+    for (const auto& v : flat) {
+        EXPECT_EQ(reference.count(v), 1u);
+        ++visited;
+    }
+    EXPECT_EQ(visited, flat.size());
+
+    flat.clear();
+    EXPECT_TRUE(flat.empty());
+    EXPECT_FALSE(flat.contains({0, 0}));
+    EXPECT_EQ(flat.begin(), flat.end());
+}
+
+TEST(HashTest, MeshEdgeDedup) {
+    // a triangulated grid: interior edges are shared by two faces, winding differs
+    std::vector<Trianglei> faces;
+    const int n = 30;
+    for (int y = 0; y < n; ++y)
+        for (int x = 0; x < n; ++x) {
+            faces.push_back({{x, y}, {x + 1, y}, {x + 1, y + 1}});
+            faces.push_back({{x, y}, {x + 1, y + 1}, {x, y + 1}});
+        }
+
+    FlatSet<Linei> edges(faces.size() * 3 / 2);
+    FlatSet<Trianglei> unique;
+    for (const auto& f : faces) {
+        edges.insert({f.p1, f.p2});
+        edges.insert({f.p2, f.p3});
+        edges.insert({f.p3, f.p1});
+        unique.insert(f);
+        EXPECT_FALSE(unique.insert({f.p3, f.p1, f.p2}));
+    }
+    // n (n + 1) horizontal + n (n + 1) vertical + n^2 diagonals
+    EXPECT_EQ(edges.size(), std::size_t(2 * n * (n + 1) + n * n));
+    EXPECT_EQ(unique.size(), faces.size());
+}
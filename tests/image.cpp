@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+    // odd sizes so both the 16 pixel blocks and the scalar tail run
+    constexpr std::size_t sizes[] = {0, 1, 7, 16, 17, 63, 1001};
+
+    std::vector<Color> randomPixels(std::size_t n, std::uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> byte(0, 255);
+        std::vector<Color> px(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            px[i] = {std::uint8_t(byte(rng)), std::uint8_t(byte(rng)), std::uint8_t(byte(rng)), std::uint8_t(byte(rng))};
+            // make the alpha extremes common
+            if (i % 5 == 0) px[i].a = 0;
+            if (i % 5 == 1) px[i].a = 255;
+        }
+        return px;
+    }
+
+    std::uint8_t over(std::uint32_t num) { return std::uint8_t(std::lround(double(num) / 255.0)); }
+
+}
+
+TEST(ImageTest, Blend) {
+    for (std::size_t n : sizes) {
+        const std::vector<Color> src = randomPixels(n, 1);
+        std::vector<Color> dst = randomPixels(n, 2);
+        std::vector<Color> expected(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Color s = src[i], d = dst[i];
+            const std::uint32_t inv = 255u - s.a;
+            expected[i] = {over(s.r * s.a + d.r * inv), over(s.g * s.a + d.g * inv),
+                           over(s.b * s.a + d.b * inv), over(s.a * 255u + d.a * inv)};
+        }
+        pixels::blend(dst, src);
+        for (std::size_t i = 0; i < n; ++i)
+            EXPECT_EQ(dst[i], expected[i]) << "n = " << n << ", i = " << i;
+    }
+
+    // opaque source replaces, transparent source keeps
+    std::vector<Color> dst(20, Color{10, 20, 30, 40});
+    std::vector<Color> src(20, Color{200, 100, 50, 255});
+    src[3].a = 0;
+    pixels::blend(dst, src);
+    EXPECT_EQ(dst[0], (Color{200, 100, 50, 255}));
+    EXPECT_EQ(dst[3], (Color{10, 20, 30, 40}));
+}
+
+TEST(ImageTest, BlendPremultiplied) {
+    for (std::size_t n : sizes) {
+        std::vector<Color> src = randomPixels(n, 3);
+        std::vector<Color> dst = randomPixels(n, 4);
+        pixels::premultiply(src);
+        pixels::premultiply(dst);
+        std::vector<Color> expected(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Color s = src[i], d = dst[i];
+            const std::uint32_t inv = 255u - s.a;
+            auto channel = [&](std::uint8_t x, std::uint8_t y) { return std::uint8_t(std::min(255, x + over(y * inv))); };
+            expected[i] = {channel(s.r, d.r), channel(s.g, d.g), channel(s.b, d.b), channel(s.a, d.a)};
+        }
+        pixels::blendPremultiplied(dst, src);
+        for (std::size_t i = 0; i < n; ++i)
+            EXPECT_EQ(dst[i], expected[i]) << "n = " << n << ", i = " << i;
+    }
+
+    // out of range source (colour above alpha) saturates instead of wrapping
+    std::vector<Color> dst(16, Color{255, 255, 255, 255});
+    std::vector<Color> src(16, Color{200, 200, 200, 100});
+    pixels::blendPremultiplied(dst, src);
+    EXPECT_EQ(dst[0], (Color{255, 255, 255, 255}));
+}
+
+TEST(ImageTest, Premultiply) {
+    for (std::size_t n : sizes) {
+        std::vector<Color> px = randomPixels(n, 5);
+        const std::vector<Color> original = px;
+        pixels::premultiply(px);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Color c = original[i];
+            EXPECT_EQ(px[i], (Color{over(c.r * c.a), over(c.g * c.a), over(c.b * c.a), c.a})) << "n = " << n << ", i = " << i;
+        }
+
+        pixels::unpremultiply(px);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Color c = original[i];
+            EXPECT_EQ(px[i].a, c.a);
+            if (c.a == 0) {
+                EXPECT_EQ(px[i], (Color{0, 0, 0, 0}));
+            } else {
+                // the 8-bit premultiplied value loses up to 255 / (2a) of the channel
+                const int tolerance = int(std::ceil(127.5 / c.a)) + 1;
+                EXPECT_LE(std::abs(int(px[i].r) - int(c.r)), tolerance);
+                EXPECT_LE(std::abs(int(px[i].g) - int(c.g)), tolerance);
+                EXPECT_LE(std::abs(int(px[i].b) - int(c.b)), tolerance);
+            }
+        }
+    }
+}
+
+TEST(ImageTest, Unpremultiply) {
+    for (std::size_t n : sizes) {
+        std::vector<Color> px = randomPixels(n, 6);
+        const std::vector<Color> original = px;
+        pixels::unpremultiply(px);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Color c = original[i];
+            const float factor = c.a > 0 ? 255.0f / float(c.a) : 0.0f;
+            auto channel = [&](std::uint8_t x) { return std::uint8_t(std::min(255.0f, std::nearbyint(float(x) * factor))); };
+            EXPECT_EQ(px[i], (Color{channel(c.r), channel(c.g), channel(c.b), c.a})) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST(ImageTest, Float4) {
+    for (std::size_t n : sizes) {
+        const std::vector<Color> px = randomPixels(n, 7);
+        std::vector<Vector4<float>> f(n);
+        pixels::toFloat4(px, f);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_FLOAT_EQ(f[i].x, float(px[i].r) / 255.0f);
+            EXPECT_FLOAT_EQ(f[i].y, float(px[i].g) / 255.0f);
+            EXPECT_FLOAT_EQ(f[i].z, float(px[i].b) / 255.0f);
+            EXPECT_FLOAT_EQ(f[i].w, float(px[i].a) / 255.0f);
+        }
+
+        std::vector<Color> back(n);
+        pixels::fromFloat4(f, back);
+        EXPECT_EQ(back, px);
+    }
+
+    // out of range values saturate, halves round to even
+    std::vector<Vector4<float>> f(17);
+    for (auto& v : f) {
+        v.x = -0.5f;
+        v.y = 2.0f;
+        v.z = 0.5f / 255.0f;
+        v.w = 2.5f / 255.0f;
+    }
+    std::vector<Color> out(17);
+    pixels::fromFloat4(f, out);
+    for (const Color& c : out)
+        EXPECT_EQ(c, (Color{0, 255, 0, 2}));
+
+    // infinities, values past the int32 range and NaN: same result in the blocks and the tail
+    const float inf = std::numeric_limits<float>::infinity();
+    for (auto& v : f) {
+        v.x = inf;
+        v.y = 1e9f;
+        v.z = -inf;
+        v.w = std::numeric_limits<float>::quiet_NaN();
+    }
+    pixels::fromFloat4(f, out);
+    for (const Color& c : out)
+        EXPECT_EQ(c, (Color{255, 255, 0, 0}));
+}
+
+TEST(ImageTest, Image) {
+    Image image(5, 3, Color{1, 2, 3, 4});
+    EXPECT_EQ(image.width(), 5u);
+    EXPECT_EQ(image.height(), 3u);
+    EXPECT_EQ(image.size(), 15u);
+    EXPECT_EQ(image(4, 2), (Color{1, 2, 3, 4}));
+
+    image(2, 1) = Color{9, 9, 9, 9};
+    EXPECT_EQ(image.row(1)[2], (Color{9, 9, 9, 9}));
+    EXPECT_EQ(image.pixels()[1 * 5 + 2], (Color{9, 9, 9, 9}));
+
+    pixels::fill(image.row(0), Color{255, 0, 0, 255});
+    EXPECT_EQ(image(4, 0), (Color{255, 0, 0, 255}));
+    EXPECT_EQ(image(0, 1), (Color{1, 2, 3, 4}));
+
+    image.fill(Color{0, 0, 255, 255});
+    Image layer(5, 3, Color{255, 0, 0, 128});
+    image.blend(layer);
+    EXPECT_EQ(image(3, 2), (Color{128, 0, 127, 255}));
+
+    std::vector<Vector4<float>> f(image.size());
+    image.toFloat4(f);
+    EXPECT_FLOAT_EQ(f[0].x, 128.0f / 255.0f);
+    Image copy(5, 3);
+    copy.fromFloat4(f);
+    EXPECT_EQ(copy(3, 2), image(3, 2));
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+#include "common.hpp"
+
+#include <vector>
+
+namespace {
+    using Tree = KdTree<double>;
+
+    const Vector3f extent = {10.0, 3.0, 0.5}; // anisotropic on purpose
+
+    Tree::Neighbor brute(const std::vector<Vector3f>& points, const Vector3f& q) {
+        Tree::Neighbor best;
+        for (Tree::Index i = 0; i < points.size(); ++i) {
+            const double d2 = (points[i] - q).square_magnitude();
+            if (d2 < best.distance2)
+                best = {i, d2};
+        }
+        return best;
+    }
+}
+
+TEST(KdTreeTest, MatchesBruteForce) {
+    const auto points = test::points3(20000, 1, extent);
+    const Tree tree(points);
+    EXPECT_EQ(tree.size(), points.size());
+
+    const auto queries = test::points3(500, 2, extent);
+    for (const auto& q : queries) {
+        const auto found = tree.nearest(q);
+        const auto expected = brute(points, q);
+        EXPECT_EQ(found.id, expected.id);
+        EXPECT_EQ(found.distance2, expected.distance2);
+    }
+
+    // points of the cloud find themselves
+    for (Tree::Index i = 0; i < 1000; ++i)
+        EXPECT_EQ(tree.nearest(points[i]).id, i);
+}
+
+TEST(KdTreeTest, Approximate) {
+    const auto points = test::points3(20000, 3, extent);
+    const Tree tree(points);
+    const double epsilon = 0.5;
+
+    const auto queries = test::points3(500, 4, extent);
+    for (const auto& q : queries) {
+        const auto found = tree.nearest(q, epsilon);
+        const auto expected = brute(points, q);
+        ASSERT_NE(found.id, Tree::none);
+        EXPECT_EQ(found.distance2, (points[found.id] - q).square_magnitude());
+        EXPECT_LE(found.distance2, expected.distance2 * (1.0 + epsilon) * (1.0 + epsilon));
+    }
+}
+
+TEST(KdTreeTest, BatchedMatchesSingle) {
+    const auto points = test::points3(30000, 5, extent);
+    const Tree tree(points);
+
+    // a slowly moving query, the case the batch seeding is meant for
+    std::vector<Vector3f> queries(2000);
+    for (std::size_t i = 0; i < queries.size(); ++i)
+        queries[i] = {-10.0 + 0.01 * double(i), 0.3, -0.1};
+
+    // an explicit thread count splits even a small batch, about 8 seeded chunks per thread
+    std::vector<Tree::Neighbor> out(queries.size()), threaded(queries.size());
+    tree.nearest(queries, out);
+    tree.nearest(queries, threaded, 0.0, 3);
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        const auto single = tree.nearest(queries[i]);
+        EXPECT_EQ(out[i].id, single.id);
+        EXPECT_EQ(out[i].distance2, single.distance2);
+        EXPECT_EQ(threaded[i].id, single.id);
+        EXPECT_EQ(threaded[i].distance2, single.distance2);
+    }
+}
+
+TEST(KdTreeTest, ParallelBuild) {
+    const auto points = test::points3(50000, 6, extent);
+    const Tree serial(points, 1), parallel(points, 4);
+
+    const auto queries = test::points3(300, 7, extent);
+    for (const auto& q : queries) {
+        const auto a = serial.nearest(q), b = parallel.nearest(q);
+        EXPECT_EQ(a.id, b.id);
+        EXPECT_EQ(a.distance2, b.distance2);
+    }
+}
+
+TEST(KdTreeTest, Degenerate) {
+    Tree tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.nearest(Vector3f{}).id, Tree::none);
+
+    // duplicates: the lowest index wins
+    std::vector<Vector3f> points(100, Vector3f{1.0, 2.0, 3.0});
+    points.push_back({0.0, 0.0, 0.0});
+    tree.build(points);
+    EXPECT_EQ(tree.nearest({1.0, 2.0, 3.5}).id, 0u);
+    EXPECT_EQ(tree.nearest({0.1, 0.0, 0.0}).id, 100u);
+    EXPECT_EQ(tree.nearest({0.1, 0.0, 0.0}).distance2, 0.1 * 0.1);
+}
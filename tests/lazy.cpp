@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace {
+    template <typename T, std::size_t N>
+    Matrix<T, N, N> makeMatrix(T seed) {
+        Matrix<T, N, N> m{};
+        for (std::size_t i = 0; i < N; ++i)
+            for (std::size_t j = 0; j < N; ++j)
+                m.data[i][j] = T(seed * T(i + 1) - T(j) / T(3) + T(0.1) * T(i * j));
+        return m;
+    }
+
+    // Same operations in the same order: equal up to FMA contraction (-ffp-contract with FMA).
+    template <typename T, std::size_t N>
+    void expectSame(const Matrix<T, N, N>& a, const Matrix<T, N, N>& b) {
+        for (std::size_t i = 0; i < N; ++i)
+            for (std::size_t j = 0; j < N; ++j)
+                EXPECT_NEAR(a(i, j), b(i, j), 1e-12 * (1.0 + std::abs(a(i, j))));
+    }
+
+    void expectSame(const Vector3f& a, const Vector3f& b) {
+        EXPECT_NEAR(a.x, b.x, 1e-12 * (1.0 + std::abs(a.x)));
+        EXPECT_NEAR(a.y, b.y, 1e-12 * (1.0 + std::abs(a.y)));
+        EXPECT_NEAR(a.z, b.z, 1e-12 * (1.0 + std::abs(a.z)));
+    }
+
+    Vector3Array<double> makeArray(std::size_t n, double seed) {
+        Vector3Array<double> a(n);
+        for (std::size_t i = 0; i < n; ++i)
+            a.set(i, {seed * double(i) - 3.0, double(i % 7) / seed, 1.0 / double(i + 1)});
+        return a;
+    }
+}
+
+// ---------- Matrix ----------
+TEST(LazyTest, MatrixMatchesEager) {
+    const auto a = makeMatrix<double, 6>(1.5);
+    const auto b = makeMatrix<double, 6>(-0.7);
+    const auto c = makeMatrix<double, 6>(0.3);
+    const double s = 1.0 / 3.0;
+
+    const Matrix<double, 6, 6> eager = a + b * s - c;
+    const Matrix<double, 6, 6> fused = lazy(a) + lazy(b) * s - c;
+    expectSame(eager, fused);
+
+    const Matrix<double, 6, 6> eager2 = (-(a - b)) / 7.0 + c * 2.0;
+    const Matrix<double, 6, 6> fused2 = -(lazy(a) - b) / 7.0 + 2.0 * lazy(c);
+    expectSame(eager2, fused2);
+
+    // the eager API is untouched: no lazy operand, no expression
+    static_assert(std::is_same<decltype(a + b), Matrix<double, 6, 6>>::value);
+    static_assert(!std::is_same<decltype(lazy(a) + b), Matrix<double, 6, 6>>::value);
+}
+
+TEST(LazyTest, MatrixTypes) {
+    // integer matrices go through the scalar pack
+    Matrix<int, 2, 2> a{{{1, 2}, {3, 4}}};
+    Matrix<int, 2, 2> b{{{4, 3}, {2, 1}}};
+    const Matrix<int, 2, 2> r = (lazy(a) - b) * 2 + a;
+    EXPECT_EQ(r(0, 0), -5);
+    EXPECT_EQ(r(1, 1), 10);
+
+    Matrix<float, 4, 4> f = makeMatrix<float, 4>(2.0f);
+    const Matrix<float, 4, 4> g = (lazy(f) * 0.5f).eval();
+    EXPECT_FLOAT_EQ(g(3, 3), f(3, 3) * 0.5f);
+}
+
+TEST(LazyTest, MatrixAliasing) {
+    auto m = makeMatrix<double, 5>(1.0);
+    const auto original = m;
+    assign(m, lazy(m) * 2.0 - original);
+    expectSame(m, original * 2.0 - original);
+
+    // an rvalue operand is kept by value, the product is evaluated eagerly first
+    const auto a = makeMatrix<double, 4>(1.5);
+    const Matrix<double, 4, 4> p = lazy(a * a) + a;
+    expectSame(p, (a * a) + a);
+}
+
+// ---------- VectorArray ----------
+TEST(LazyTest, VectorArrayMatchesScalar) {
+    for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(5), std::size_t(37)}) {
+        const auto position = makeArray(n, 0.5);
+        const auto velocity = makeArray(n, -1.25);
+        const auto force = makeArray(n, 3.0);
+        const double dt = 0.01;
+
+        Vector3Array<double> out;
+        assign(out, lazy(position) + lazy(velocity) * dt - lazy(force) / 3.0);
+        ASSERT_EQ(out.size(), n);
+        for (std::size_t i = 0; i < n; ++i)
+            expectSame(out[i], position[i] + velocity[i] * dt - force[i] / 3.0);
+
+        const Vector3Array<double> negated = -lazy(position);
+        ASSERT_EQ(negated.size(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(negated[i].x, -position[i].x);
+            EXPECT_EQ(std::signbit(negated[i].y), !std::signbit(position[i].y));
+        }
+    }
+}
+
+TEST(LazyTest, VectorArrayInPlace) {
+    auto position = makeArray(19, 0.5);
+    const auto velocity = makeArray(19, 2.0);
+    const auto before = position;
+    assign(position, lazy(position) + lazy(velocity) * 0.5);
+    for (std::size_t i = 0; i < 19; ++i)
+        expectSame(position[i], before[i] + velocity[i] * 0.5);
+}
+
+TEST(LazyTest, VectorArraySizeMismatch) {
+#ifdef NDEBUG
+    GTEST_SKIP() << "the size check is a debug assert";
+#else
+    const auto a = makeArray(19, 0.5);
+    const auto b = makeArray(18, 2.0);
+    Vector3Array<double> out;
+    EXPECT_DEATH(assign(out, lazy(a) + b), "same size");
+#endif
+}
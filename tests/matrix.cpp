@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <cstring>
+
+namespace {
+    template <typename T>
+    Matrix<T, 4, 4> makeMatrix(T seed) {
+        Matrix<T, 4, 4> m{};
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                m.data[i][j] = T(seed * T(i + 1) - T(j) / T(3) + T(0.1) * T(i * j));
+        m.data[2][1] = T(-0.0);
+        return m;
+    }
+
+    template <typename T, std::size_t R, std::size_t C>
+    bool sameBits(const T (&a)[R][C], const T (&b)[R][C]) {
+        return std::memcmp(a, b, sizeof(a)) == 0;
+    }
+}
+
+// ---------- Matrix ----------
+TEST(MatrixTest, IdentityMultiply) {
+    Matrix4x4 a = makeMatrix<double>(1.5);
+    Matrix4x4 r = a * Matrix4x4::identity();
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_DOUBLE_EQ(r(i, j), a(i, j));
+}
+
+TEST(MatrixTest, Transpose) {
+    Matrix3x3 m{{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}};
+    Matrix3x3 t = m.transpose();
+    EXPECT_DOUBLE_EQ(t(0, 1), 4);
+    EXPECT_DOUBLE_EQ(t(2, 0), 3);
+}
+
+TEST(MatrixTest, VectorProduct) {
+    Matrix4x4 translate = Matrix4x4::identity();
+    translate(0, 3) = 10;
+    translate(1, 3) = 20;
+    translate(2, 3) = 30;
+
+    Vector4f p = translate * Vector4f{1, 1, 2, 3}; // w, x, y, z
+    EXPECT_DOUBLE_EQ(p.w, 1.0);
+    EXPECT_DOUBLE_EQ(p.x, 11.0);
+    EXPECT_DOUBLE_EQ(p.y, 22.0);
+    EXPECT_DOUBLE_EQ(p.z, 33.0);
+}
+
+// ---------- SIMD kernels against the reference ----------
+template <typename T>
+class Matrix4KernelTest : public ::testing::Test {};
+
+using KernelTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(Matrix4KernelTest, KernelTypes);
+
+TYPED_TEST(Matrix4KernelTest, MultiplyIsBitIdentical) {
+    using T = TypeParam;
+    auto a = makeMatrix<T>(T(1.7));
+    auto b = makeMatrix<T>(T(-0.3));
+
+    Matrix<T, 4, 4> expected{};
+    MatrixReference<T, 4, 4>::multiply(a.data, b.data, expected.data);
+    EXPECT_TRUE(sameBits((a * b).data, expected.data));
+}
+
+TYPED_TEST(Matrix4KernelTest, TransposeIsBitIdentical) {
+    using T = TypeParam;
+    auto a = makeMatrix<T>(T(2.1));
+
+    Matrix<T, 4, 4> expected{};
+    MatrixReference<T, 4, 4>::transpose(a.data, expected.data);
+    EXPECT_TRUE(sameBits(a.transpose().data, expected.data));
+}
+
+TYPED_TEST(Matrix4KernelTest, ApplyIsBitIdentical) {
+    using T = TypeParam;
+    auto a = makeMatrix<T>(T(0.7));
+    const T v[4] = {T(1.25), T(-3), T(0.1), T(1)};
+
+    T expected[4], actual[4];
+    MatrixReference<T, 4, 4>::apply(a.data, v, expected);
+    MatrixKernel<T, 4, 4>::apply(a.data, v, actual);
+    EXPECT_EQ(std::memcmp(expected, actual, sizeof(expected)), 0);
+}
+
+// ---------- Determinant / inverse ----------
+namespace {
+    template <typename T, std::size_t N>
+    Matrix<T, N, N> makeInvertible() {
+        Matrix<T, N, N> m{};
+        for (std::size_t i = 0; i < N; ++i)
+            for (std::size_t j = 0; j < N; ++j)
+                m.data[i][j] = T((i * 7 + j * 3) % 5) - T(2) + (i == j ? T(2 * N) : T(0));
+        return m;
+    }
+
+    template <typename T, std::size_t N>
+    void expectIdentity(const Matrix<T, N, N>& m, T tolerance) {
+        for (std::size_t i = 0; i < N; ++i)
+            for (std::size_t j = 0; j < N; ++j)
+                EXPECT_NEAR(m.data[i][j], i == j ? T(1) : T(0), tolerance);
+    }
+}
+
+TEST(MatrixTest, DeterminantConstexpr) {
+    constexpr Matrix3x3 m{{{2, 0, 1}, {1, 3, 2}, {1, 1, 2}}};
+    static_assert(m.determinant() == 6.0, "closed form determinant must be usable at compile time");
+
+    constexpr Matrix<double, 2, 2> m2{{{4, 7}, {2, 6}}};
+    static_assert(m2.determinant() == 10.0);
+}
+
+TEST(MatrixTest, ClosedFormMatchesLU) {
+    auto m2 = makeInvertible<double, 2>();
+    auto m3 = makeInvertible<double, 3>();
+    auto m4 = makeInvertible<double, 4>();
+
+    EXPECT_NEAR(m2.determinant(), m2.lu().determinant(), 1e-9);
+    EXPECT_NEAR(m3.determinant(), m3.lu().determinant(), 1e-9);
+    EXPECT_NEAR(m4.determinant(), m4.lu().determinant(), 1e-9);
+
+    expectIdentity(m2 * m2.inverse(), 1e-12);
+    expectIdentity(m3 * m3.inverse(), 1e-12);
+    expectIdentity(m4 * m4.inverse(), 1e-12);
+    expectIdentity(m4 * m4.lu().inverse(), 1e-12);
+}
+
+TEST(MatrixTest, LargeInverseUsesLU) {
+    auto m = makeInvertible<double, 6>();
+    m.data[0][0] = 0; // forces a pivot
+    expectIdentity(m * m.inverse(), 1e-12);
+
+    const double b[6] = {1, 2, 3, 4, 5, 6};
+    double x[6];
+    m.lu().solve(b, x);
+    for (std::size_t i = 0; i < 6; ++i) {
+        double sum = 0;
+        for (std::size_t j = 0; j < 6; ++j)
+            sum += m.data[i][j] * x[j];
+        EXPECT_NEAR(sum, b[i], 1e-12);
+    }
+}
+
+TEST(MatrixTest, LargeIntegerDeterminant) {
+    // integers above 4x4: exact Bareiss elimination instead of the floating point LU
+    constexpr Matrix<int, 5, 5> m{{{2, -1, 0, 3, 1}, {4, 0, 1, -2, 5}, {0, 3, -1, 1, 2}, {1, 2, 2, 0, -3}, {-2, 1, 4, 1, 0}}};
+    static_assert(m.determinant() == -1612);
+
+    Matrix<int, 6, 6> p{};
+    Matrix<double, 6, 6> d{};
+    for (std::size_t i = 0; i < 6; ++i)
+        for (std::size_t j = 0; j < 6; ++j)
+            d.data[i][j] = p.data[i][j] = int((i * 5 + j * 3) % 7) - 3 + (i == j ? 6 : 0);
+    p.data[0][0] = 0; // forces a row swap
+    d.data[0][0] = 0;
+    EXPECT_EQ(double(p.determinant()), std::round(d.determinant()));
+
+    Matrix<int, 5, 5> singular = m;
+    for (std::size_t j = 0; j < 5; ++j)
+        singular.data[4][j] = singular.data[0][j] * 2;
+    EXPECT_EQ(singular.determinant(), 0);
+}
+
+TEST(MatrixTest, SingularInverseIsZero) {
+    Matrix3x3 m{{{1, 2, 3}, {2, 4, 6}, {0, 1, 1}}};
+    EXPECT_DOUBLE_EQ(m.determinant(), 0.0);
+    EXPECT_TRUE(m.lu().singular);
+
+    Matrix3x3 inv = m.inverse();
+    for (std::size_t i = 0; i < 3; ++i)
+        for (std::size_t j = 0; j < 3; ++j)
+            EXPECT_DOUBLE_EQ(inv(i, j), 0.0);
+
+    // singular 3x3 block of an affine transform
+    Matrix4x4 affine{{
+        {1.0, 2.0, 3.0, 5.0},
+        {2.0, 4.0, 6.0, -1.0},
+        {0.0, 1.0, 1.0, 2.0},
+        {0.0, 0.0, 0.0, 1.0}
+    }};
+    Matrix4x4 affineInv = affine.inverseAffine();
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_DOUBLE_EQ(affineInv(i, j), 0.0);
+}
+
+TEST(MatrixTest, AffineInverse) {
+    Matrix4x4 m{{
+        {0.0, -2.0, 0.0, 10.0},
+        {1.0,  0.0, 0.0, 20.0},
+        {0.0,  0.0, 4.0, 30.0},
+        {0.0,  0.0, 0.0,  1.0}
+    }};
+    Matrix4x4 fast = m.inverseAffine();
+    Matrix4x4 full = m.inverse();
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_NEAR(fast(i, j), full(i, j), 1e-12);
+    expectIdentity(m * fast, 1e-12);
+}
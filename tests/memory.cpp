@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+#include "common.hpp"
+
+#include <cstdint>
+#include <list>
+#include <memory_resource>
+#include <set>
+#include <vector>
+
+namespace {
+    // counts what reaches the upstream resource
+    class CountingResource : public std::pmr::memory_resource {
+        public:
+            std::size_t allocations = 0;
+            std::size_t live = 0;
+
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+                ++allocations;
+                ++live;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+                --live;
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+}
+
+// ---------- MonotonicArena ----------
+TEST(MemoryTest, ArenaAlignmentAndGrowth) {
+    CountingResource upstream;
+    {
+        MonotonicArena arena(1024, &upstream);
+        for (std::size_t alignment : {1u, 2u, 8u, 16u, 64u, 256u}) {
+            void* p = arena.allocate(3, alignment);
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignment, 0u);
+        }
+
+        // larger than a chunk
+        void* big = arena.allocate(10000, 32);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 32, 0u);
+        EXPECT_GE(arena.capacity(), 10000u);
+        EXPECT_GE(arena.used(), 10000u + 18u);
+        EXPECT_EQ(upstream.allocations, 2u);
+
+        arena.release();
+        EXPECT_EQ(upstream.live, 0u);
+        EXPECT_EQ(arena.capacity(), 0u);
+        EXPECT_NE(arena.allocate(8, 8), nullptr);
+    }
+    EXPECT_EQ(upstream.live, 0u); // the destructor releases the chunks
+}
+
+TEST(MemoryTest, ArenaResetReusesChunks) {
+    CountingResource upstream;
+    MonotonicArena arena(4096, &upstream);
+    std::vector<void*> first;
+    for (int i = 0; i < 100; ++i)
+        first.push_back(arena.allocate(100, 8));
+    const std::size_t chunks = upstream.allocations;
+
+    for (int frame = 0; frame < 5; ++frame) {
+        arena.reset();
+        EXPECT_EQ(arena.used(), 0u);
+        for (int i = 0; i < 100; ++i)
+            EXPECT_EQ(arena.allocate(100, 8), first[std::size_t(i)]);
+    }
+    EXPECT_EQ(upstream.allocations, chunks);
+}
+
+TEST(MemoryTest, ArenaWithContainers) {
+    MonotonicArena arena;
+    std::pmr::vector<Vector2f> points(&arena);
+    for (int i = 0; i < 1000; ++i)
+        points.push_back({double(i), double(-i)});
+    std::pmr::set<int> set(&arena);
+    for (int i = 0; i < 100; ++i)
+        set.insert(i * 7 % 100);
+    EXPECT_EQ(points[999].y, -999.0);
+    EXPECT_EQ(set.size(), 100u);
+    EXPECT_EQ(*set.begin(), 0);
+}
+
+// ---------- FixedPool ----------
+TEST(MemoryTest, PoolReusesBlocks) {
+    CountingResource upstream;
+    FixedPool pool(24, 16, &upstream);
+    EXPECT_EQ(pool.blockSize(), 32u);
+
+    void* a = pool.allocate(24, 8);
+    void* b = pool.allocate(16, 16);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 16, 0u);
+    EXPECT_EQ(pool.inUse(), 2u);
+    pool.deallocate(a, 24, 8);
+    EXPECT_EQ(pool.allocate(24, 8), a); // last freed, first reused
+    EXPECT_EQ(upstream.allocations, 1u);
+
+    // larger requests go upstream and come back there
+    void* big = pool.allocate(100, 8);
+    EXPECT_EQ(upstream.allocations, 2u);
+    pool.deallocate(big, 100, 8);
+    EXPECT_EQ(upstream.live, 1u);
+
+    // 16 blocks per chunk: 40 blocks need 3 chunks, a reset keeps them
+    pool.reset();
+    for (int i = 0; i < 40; ++i)
+        EXPECT_NE(pool.allocate(8, 8), nullptr);
+    EXPECT_EQ(upstream.live, 3u);
+    pool.reset();
+    for (int i = 0; i < 40; ++i)
+        EXPECT_NE(pool.allocate(8, 8), nullptr);
+    EXPECT_EQ(upstream.live, 3u);
+    pool.release();
+    EXPECT_EQ(upstream.live, 0u);
+}
+
+TEST(MemoryTest, PoolNodeContainers) {
+    CountingResource upstream;
+    FixedPool pool(0, 64, &upstream);
+    {
+        std::pmr::list<Vector2f> list(&pool);
+        for (int i = 0; i < 1000; ++i)
+            list.push_back({double(i), 0});
+        EXPECT_GE(pool.blockSize(), sizeof(Vector2f));
+        EXPECT_EQ(pool.inUse(), 1000u);
+        for (int k = 0; k < 10; ++k) {
+            list.remove_if([](const Vector2f& v) { return int(v.x) % 2 == 0; });
+            for (int i = 0; i < 500; ++i)
+                list.push_back({double(2 * i), 1});
+        }
+        EXPECT_EQ(list.size(), 1000u);
+    }
+    EXPECT_EQ(pool.inUse(), 0u);
+    EXPECT_EQ(upstream.allocations, 1000u / 64 + 1); // freed nodes were reused
+}
+
+// ---------- Algorithms ----------
+TEST(MemoryTest, DelaunayInArena) {
+    const auto points = test::points2(2000, 1);
+    const Delaunay<double> reference(points);
+
+    CountingResource upstream;
+    MonotonicArena arena(MonotonicArena::defaultChunkSize, &upstream);
+    std::size_t chunks = 0;
+    for (int frame = 0; frame < 3; ++frame) {
+        {
+            const Delaunay<double> d(points, &arena);
+            EXPECT_EQ(d.resource(), &arena);
+            ASSERT_EQ(d.indices().size(), reference.indices().size());
+            EXPECT_TRUE(std::equal(d.indices().begin(), d.indices().end(), reference.indices().begin()));
+
+            const auto triangles = d.triangles(&arena);
+            ASSERT_EQ(triangles.size(), reference.indices().size());
+            EXPECT_EQ(triangles[0], reference.triangles()[0]);
+        }
+        if (frame == 0)
+            chunks = upstream.allocations;
+        arena.reset();
+    }
+    EXPECT_EQ(upstream.allocations, chunks); // later frames never reach the upstream resource
+}
+
+TEST(MemoryTest, FlatSetInArena) {
+    MonotonicArena arena;
+    FlatSet<Vector2i> set(16, &arena);
+    for (int i = 0; i < 1000; ++i)
+        set.insert({i % 300, i % 7});
+    EXPECT_EQ(set.resource(), &arena);
+    EXPECT_TRUE(set.contains({299, 299 % 7}));
+    EXPECT_GT(arena.used(), 0u);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+    template <typename T>
+    void expectBatchMatchesScalar(const Triangle<T>& triangle, const std::vector<Vector2<T>>& points) {
+        const Vector2Array<T> soa{std::span<const Vector2<T>>(points)};
+        std::vector<std::uint8_t> inside(points.size());
+        const std::size_t count = insideTriangle(triangle, soa, inside);
+
+        std::size_t expected = 0;
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            const bool scalar = triangle.isInside(points[i]);
+            expected += scalar;
+            EXPECT_EQ(bool(inside[i]), scalar) << i;
+        }
+        EXPECT_EQ(count, expected);
+    }
+
+    // Random points around the triangle plus points exactly on its edges and vertices.
+    template <typename T>
+    std::vector<Vector2<T>> samples(const Triangle<T>& t, std::size_t n, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> u(-2.0, 12.0);
+        std::vector<Vector2<T>> points;
+        for (std::size_t i = 0; i < n; ++i)
+            points.push_back({T(u(rng)), T(u(rng))});
+        for (const auto& [a, b] : {std::pair{t.p1, t.p2}, std::pair{t.p2, t.p3}, std::pair{t.p3, t.p1}}) {
+            points.push_back(a);
+            points.push_back({(a.x + b.x) / T(2), (a.y + b.y) / T(2)});
+        }
+        return points;
+    }
+}
+
+TEST(PointLocationTest, BatchMatchesScalar) {
+    const Trianglef ccw{{0.0, 0.0}, {10.0, 0.0}, {0.0, 8.0}};
+    const Trianglef cw{{0.0, 0.0}, {0.0, 8.0}, {10.0, 0.0}};
+    expectBatchMatchesScalar(ccw, samples(ccw, 1001, 1));
+    expectBatchMatchesScalar(cw, samples(cw, 1001, 2));
+
+    // points a hair away from the long edge: the filter gives up, the exact test decides
+    const Trianglef thin{{0.1, 0.1}, {9.7, 3.3}, {0.3, 0.2}};
+    std::vector<Vector2f> near;
+    for (int i = 0; i < 257; ++i) {
+        const double t = double(i) / 256.0;
+        const Vector2f on{0.1 + t * 9.6, 0.1 + t * 3.2};
+        near.push_back({std::nextafter(on.x, 100.0), on.y});
+        near.push_back({std::nextafter(on.x, -100.0), on.y});
+        near.push_back(on);
+    }
+    expectBatchMatchesScalar(thin, near);
+
+    // degenerate triangle: only points on its segment are "inside"
+    const Trianglef flat{{0.0, 0.0}, {2.0, 2.0}, {4.0, 4.0}};
+    expectBatchMatchesScalar(flat, std::vector<Vector2f>{{1.0, 1.0}, {3.0, 3.0}, {1.0, 2.0}, {5.0, 5.0}, {-1.0, 0.0}});
+}
+
+TEST(PointLocationTest, BatchOtherTypes) {
+    const Triangle<float> f{{0.0f, 0.0f}, {10.0f, 0.0f}, {3.0f, 7.0f}};
+    expectBatchMatchesScalar(f, samples(f, 500, 3));
+
+    const Trianglei i{{0, 0}, {10, 0}, {4, 10}};
+    expectBatchMatchesScalar(i, samples(i, 500, 4));
+}
+
+TEST(PointLocationTest, LocateInTriangulation) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> u(0.0, 10.0);
+    std::vector<Vector2f> vertices(400);
+    for (auto& v : vertices)
+        v = {u(rng), u(rng)};
+
+    Delaunay<double> delaunay;
+    delaunay.triangulate(vertices);
+    const auto& faces = delaunay.indices();
+    const TriangleLocator<double> locator(vertices, faces);
+    EXPECT_EQ(locator.size(), faces.size());
+
+    // brute force: lowest face containing p
+    auto brute = [&](const Vector2f& p) {
+        for (std::size_t f = 0; f < faces.size(); ++f)
+            if (locator.triangle(TriangleLocator<double>::Index(f)).isInside(p))
+                return TriangleLocator<double>::Index(f);
+        return TriangleLocator<double>::none;
+    };
+
+    std::uniform_real_distribution<double> q(-1.0, 11.0);
+    std::vector<Vector2f> queries(2000);
+    for (auto& p : queries)
+        p = {q(rng), q(rng)};
+    queries.insert(queries.end(), vertices.begin(), vertices.begin() + 50); // shared vertices
+
+    std::vector<TriangleLocator<double>::Index> out(queries.size());
+    locator.locate(queries, out);
+    std::size_t located = 0;
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(out[i], brute(queries[i])) << i;
+        located += out[i] != TriangleLocator<double>::none;
+    }
+    EXPECT_GT(located, queries.size() / 2);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <cstdint>
+#include <random>
+
+namespace {
+    int sign(double v) { return (v > 0.0) - (v < 0.0); }
+    int sign(__int128 v) { return (v > 0) - (v < 0); }
+
+    // Exact references on integer coordinates.
+    __int128 orientRef(std::int64_t ax, std::int64_t ay, std::int64_t bx, std::int64_t by, std::int64_t cx, std::int64_t cy) {
+        return __int128(ax - cx) * (by - cy) - __int128(ay - cy) * (bx - cx);
+    }
+
+    __int128 incircleRef(const std::int64_t (&c)[8]) {
+        const __int128 adx = c[0] - c[6], ady = c[1] - c[7];
+        const __int128 bdx = c[2] - c[6], bdy = c[3] - c[7];
+        const __int128 cdx = c[4] - c[6], cdy = c[5] - c[7];
+        return (adx * adx + ady * ady) * (bdx * cdy - cdx * bdy)
+             + (bdx * bdx + bdy * bdy) * (cdx * ady - adx * cdy)
+             + (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady);
+    }
+}
+
+// ---------- orient2d ----------
+TEST(PredicatesTest, OrientSimple) {
+    EXPECT_GT(orient2d(Vector2f{0, 0}, Vector2f{1, 0}, Vector2f{0, 1}), 0.0);
+    EXPECT_LT(orient2d(Vector2f{0, 0}, Vector2f{0, 1}, Vector2f{1, 0}), 0.0);
+    EXPECT_EQ(orient2d(Vector2i{0, 0}, Vector2i{2, 2}, Vector2i{5, 5}), 0.0);
+}
+
+// Points a few ulps off the line y = x: the plain determinant gets the sign wrong.
+TEST(PredicatesTest, OrientNearDegenerate) {
+    std::mt19937_64 rng(1);
+    const double b = 12.0, c = 24.0;
+
+    for (int i = 0; i < 20000; ++i) {
+        const std::int64_t ix = std::int64_t(rng() % 256), iy = std::int64_t(rng() % 256);
+        const double ax = 0.5 + double(ix) * 0x1p-53, ay = 0.5 + double(iy) * 0x1p-53;
+
+        // scaled by 2^53 every coordinate is an integer
+        const std::int64_t one = std::int64_t(1) << 53;
+        const __int128 ref = orientRef(one / 2 + ix, one / 2 + iy, 12 * one, 12 * one, 24 * one, 24 * one);
+        ASSERT_EQ(sign(predicates::orient2d(ax, ay, b, b, c, c)), sign(ref)) << i;
+    }
+}
+
+// ---------- incircle ----------
+TEST(PredicatesTest, IncircleSimple) {
+    Vector2f a{5, 0}, b{0, 5}, c{-5, 0};
+    EXPECT_GT(incircle(a, b, c, Vector2f{0, 0}), 0.0);
+    EXPECT_LT(incircle(a, b, c, Vector2f{10, 10}), 0.0);
+    EXPECT_EQ(incircle(a, b, c, Vector2f{3, -4}), 0.0);
+    EXPECT_GT(incircle(a, b, c, Vector2f{3, -3.9999999999999}), 0.0);
+}
+
+TEST(PredicatesTest, IncircleNearCocircular) {
+    std::mt19937_64 rng(2);
+    const std::int64_t r = 1000003;
+
+    for (int i = 0; i < 20000; ++i) {
+        std::int64_t c[8] = {r, 0, 0, r, -r, 0, 0, -r};
+        c[6] += std::int64_t(rng() % 3) - 1;
+        c[7] += std::int64_t(rng() % 3) - 1;
+
+        const double det = predicates::incircle(double(c[0]), double(c[1]), double(c[2]), double(c[3]),
+                                                double(c[4]), double(c[5]), double(c[6]), double(c[7]));
+        ASSERT_EQ(sign(det), sign(incircleRef(c))) << i;
+    }
+}
+
+TEST(PredicatesTest, ExactMatchesReference) {
+    std::mt19937_64 rng(3);
+    for (int i = 0; i < 20000; ++i) {
+        std::int64_t c[8];
+        for (auto& v : c)
+            v = std::int64_t(rng() % 2000001) - 1000000;
+
+        const double det = predicates::incircleExact(double(c[0]), double(c[1]), double(c[2]), double(c[3]),
+                                                     double(c[4]), double(c[5]), double(c[6]), double(c[7]));
+        ASSERT_EQ(sign(det), sign(incircleRef(c))) << i;
+
+        const double o = predicates::orient2dExact(double(c[0]), double(c[1]), double(c[2]), double(c[3]), double(c[4]), double(c[5]));
+        ASSERT_EQ(sign(o), sign(orientRef(c[0], c[1], c[2], c[3], c[4], c[5]))) << i;
+    }
+}
+
+// ---------- Triangle ----------
+TEST(PredicatesTest, TriangleIsInside) {
+    Trianglef ccw{{0, 0}, {4, 0}, {0, 4}};
+    Trianglef cw{{0, 0}, {0, 4}, {4, 0}};
+
+    for (const Trianglef& t : {ccw, cw}) {
+        EXPECT_TRUE(t.isInside({1, 1}));
+        EXPECT_TRUE(t.isInside({2, 2}));   // on the hypotenuse
+        EXPECT_TRUE(t.isInside({0, 0}));   // vertex
+        EXPECT_FALSE(t.isInside({3, 3}));
+        EXPECT_FALSE(t.isInside({-1, 1}));
+    }
+}
+
+TEST(PredicatesTest, TriangleIsInsideCircumcircle) {
+    Trianglef ccw{{5, 0}, {0, 5}, {-5, 0}};
+    Trianglef cw{{5, 0}, {-5, 0}, {0, 5}};
+
+    for (const Trianglef& t : {ccw, cw}) {
+        EXPECT_TRUE(t.isInsideCircumcircle({0, -4.9}));
+        EXPECT_FALSE(t.isInsideCircumcircle({0, -5}));
+        EXPECT_FALSE(t.isInsideCircumcircle({6, 0}));
+    }
+}
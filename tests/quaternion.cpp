@@ -2,9 +2,10 @@
 #include "Quaternion.hpp"
 #include "Constants.hpp"
 #include <cmath>
+#include <vector>
 
 TEST(QuaternionTest, DefaultInitialization) {
-    Quaternion q;
+    Quaterniond q;
     EXPECT_FLOAT_EQ(q.w, 1.0f);
     EXPECT_FLOAT_EQ(q.x, 0.0f);
     EXPECT_FLOAT_EQ(q.y, 0.0f);
@@ -12,7 +13,7 @@ TEST(QuaternionTest, DefaultInitialization) {
 }
 
 TEST(QuaternionTest, CustomInitialization) {
-    Quaternion q(0.5f, 1.0f, 2.0f, 3.0f);
+    Quaterniond q(0.5f, 1.0f, 2.0f, 3.0f);
     EXPECT_FLOAT_EQ(q.w, 0.5f);
     EXPECT_FLOAT_EQ(q.x, 1.0f);
     EXPECT_FLOAT_EQ(q.y, 2.0f);
@@ -20,7 +21,7 @@ TEST(QuaternionTest, CustomInitialization) {
 }
 
 TEST(QuaternionTest, IdentityQuaternion) {
-    Quaternion q = Quaternion::identity();
+    Quaterniond q = Quaterniond::identity();
     EXPECT_FLOAT_EQ(q.w, 1.0f);
     EXPECT_FLOAT_EQ(q.x, 0.0f);
     EXPECT_FLOAT_EQ(q.y, 0.0f);
@@ -31,7 +32,7 @@ TEST(QuaternionTest, FromAxisAngle) {
     Vector3f axis{0, 0, 1};
     float angle = static_cast<float>(M_PI) / 2.0f;  // 90 degrees
 
-    Quaternion q = Quaternion::fromAxisAngle(angle, axis);
+    Quaterniond q = Quaterniond::fromAxisAngle(angle, axis);
     q.normalize();
 
     EXPECT_NEAR(q.w, std::cos(angle / 2.0f), epsilonf);
@@ -41,7 +42,7 @@ TEST(QuaternionTest, FromAxisAngle) {
 }
 
 TEST(QuaternionTest, Normalize) {
-    Quaternion q(0, 3, 0, 4);
+    Quaterniond q(0, 3, 0, 4);
     q.normalize();
 
     float magnitude = std::sqrt(3*3 + 4*4);
@@ -52,8 +53,8 @@ TEST(QuaternionTest, Normalize) {
 }
 
 TEST(QuaternionTest, Conjugate) {
-    Quaternion q(1, 2, 3, 4);
-    Quaternion c = q.conjugate();
+    Quaterniond q(1, 2, 3, 4);
+    Quaterniond c = q.conjugate();
 
     EXPECT_FLOAT_EQ(c.w, 1.0f);
     EXPECT_FLOAT_EQ(c.x, -2.0f);
@@ -62,10 +63,10 @@ TEST(QuaternionTest, Conjugate) {
 }
 
 TEST(QuaternionTest, Multiply) {
-    Quaternion q1(1, 0, 1, 0);
-    Quaternion q2(1, 0.5f, 0.5f, 0.75f);
+    Quaterniond q1(1, 0, 1, 0);
+    Quaterniond q2(1, 0.5f, 0.5f, 0.75f);
 
-    Quaternion result = q1 * q2;
+    Quaterniond result = q1 * q2;
 
     EXPECT_NEAR(result.w, 0.5f, epsilonf);
     EXPECT_NEAR(result.x, 1.25f, epsilonf);
@@ -74,7 +75,7 @@ TEST(QuaternionTest, Multiply) {
 }
 
 TEST(QuaternionTest, RotateVector90DegAroundZ) {
-    Quaternion q = Quaternion::fromAxisAngle(static_cast<float>(M_PI) / 2.0f, {0, 0, 1});
+    Quaterniond q = Quaterniond::fromAxisAngle(static_cast<float>(M_PI) / 2.0f, {0, 0, 1});
     Vector3f point(1, 0, 0);
 
     Vector3f rotated = q.rotate(point);
@@ -87,7 +88,7 @@ TEST(QuaternionTest, FromVectorsParallel) {
     Vector3f v1(1, 0, 0);
     Vector3f v2(1, 0, 0);
 
-    Quaternion q = Quaternion::fromVectors(v1, v2);
+    Quaterniond q = Quaterniond::fromVectors(v1, v2);
     EXPECT_FLOAT_EQ(q.w, 1.0f);
     EXPECT_FLOAT_EQ(q.x, 0.0f);
     EXPECT_FLOAT_EQ(q.y, 0.0f);
@@ -98,8 +99,149 @@ TEST(QuaternionTest, FromVectorsOpposite) {
     Vector3f v1(1, 0, 0);
     Vector3f v2(-1, 0, 0);
 
-    Quaternion q = Quaternion::fromVectors(v1, v2);
+    Quaterniond q = Quaterniond::fromVectors(v1, v2);
     // For 180° rotation, expect w ≈ 0 and rotation axis perpendicular to v1
     EXPECT_NEAR(q.w, 0.0f, epsilonf);
     EXPECT_NEAR(std::sqrt(q.x*q.x + q.y*q.y + q.z*q.z), 1.0f, epsilonf);
-}
\ No newline at end of file
+}
+
+TEST(QuaternionTest, RotateMatchesHamiltonProduct) {
+    Quaterniond q(0.9f, 0.3f, -0.2f, 0.4f); // not normalised on purpose
+    Vector3f point(1.5, -2, 0.25);
+    Vector3f center(0.5, 1, -1);
+
+    Quaterniond p(0, point.x - center.x, point.y - center.y, point.z - center.z);
+    Quaterniond r = (q * p) * q.conjugate();
+
+    Vector3f rotated = q.rotate(point, center);
+    EXPECT_NEAR(rotated.x, r.x + center.x, 1e-5);
+    EXPECT_NEAR(rotated.y, r.y + center.y, 1e-5);
+    EXPECT_NEAR(rotated.z, r.z + center.z, 1e-5);
+}
+
+TEST(QuaternionTest, BulkRotate) {
+    Quaterniond q = Quaterniond::fromAxisAngle(0.7f, {0, 0.6, 0.8});
+    Vector3f center(1, 2, 3);
+
+    std::vector<Vector3f> points;
+    for (int i = 0; i < 131; ++i)
+        points.push_back({i * 0.1, 1.0 - i * 0.05, i % 3 - 1.0});
+    std::vector<Vector3f> out(points.size());
+
+    q.rotate(points, out, center);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        EXPECT_TRUE(out[i].same(q.rotate(points[i], center), 1e-9)) << i;
+
+    std::vector<Vector3f> inPlace = points;
+    q.rotate(inPlace, inPlace);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        EXPECT_TRUE(inPlace[i].same(q.rotate(points[i]), 1e-9)) << i;
+}
+
+TEST(QuaternionTest, FloatPrecision) {
+    static_assert(std::is_same_v<decltype(Quaternionf{}.w), float>);
+    static_assert(std::is_same_v<decltype(Quaternionf{}.rotate(Vector3s{})), Vector3s>);
+    static_assert(std::is_same_v<decltype(Quaterniond{}.rotate(Vector3f{})), Vector3f>);
+
+    Quaternionf q = Quaternionf::fromAxisAngle(static_cast<float>(M_PI) / 2.0f, Vector3s{0, 0, 1});
+    Vector3s rotated = q.rotate(Vector3s{1, 0, 0});
+    EXPECT_NEAR(rotated.x, 0.0f, epsilonf);
+    EXPECT_NEAR(rotated.y, 1.0f, epsilonf);
+    EXPECT_NEAR(rotated.z, 0.0f, epsilonf);
+}
+
+TEST(QuaternionTest, ConstexprConstruction) {
+    constexpr Quaterniond a(1, 0, 1, 0);
+    constexpr Quaterniond b = Quaterniond::identity();
+    constexpr Quaterniond c = (a * b).conjugate();
+    static_assert(c.w == 1 && c.y == -1);
+    EXPECT_DOUBLE_EQ(c.x, 0.0);
+}
+
+// ---------- Interpolation ----------
+TEST(QuaternionTest, SlerpEndpointsAndMidpoint) {
+    Quaterniond a = Quaterniond::identity();
+    Quaterniond b = Quaterniond::fromAxisAngle(M_PI / 2, {0, 0, 1});
+
+    Quaterniond start = Quaterniond::slerp(a, b, 0);
+    Quaterniond end = Quaterniond::slerp(a, b, 1);
+    Quaterniond mid = Quaterniond::slerp(a, b, 0.5);
+    Quaterniond expected = Quaterniond::fromAxisAngle(M_PI / 4, {0, 0, 1});
+
+    EXPECT_NEAR(start.w, 1.0, 1e-12);
+    EXPECT_NEAR(end.z, b.z, 1e-12);
+    EXPECT_NEAR(mid.w, expected.w, 1e-12);
+    EXPECT_NEAR(mid.z, expected.z, 1e-12);
+}
+
+TEST(QuaternionTest, InterpolationTakesShortestPath) {
+    Quaterniond a = Quaterniond::identity();
+    Quaterniond b = -Quaterniond::fromAxisAngle(0.2, {1, 0, 0}); // same rotation, opposite hemisphere
+
+    Quaterniond s = Quaterniond::slerp(a, b, 0.5);
+    Quaterniond n = Quaterniond::nlerp(a, b, 0.5);
+    Quaterniond expected = Quaterniond::fromAxisAngle(0.1, {1, 0, 0});
+    EXPECT_NEAR(s.w, expected.w, 1e-12);
+    EXPECT_NEAR(s.x, expected.x, 1e-12);
+    EXPECT_NEAR(n.w, expected.w, 1e-12);
+    EXPECT_NEAR(n.x, expected.x, 1e-12);
+}
+
+template <typename T>
+class QuaternionBlendTest : public ::testing::Test {};
+
+using BlendTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(QuaternionBlendTest, BlendTypes);
+
+TYPED_TEST(QuaternionBlendTest, BatchMatchesScalar) {
+    using T = TypeParam;
+    using Q = Quaternion<T>;
+    const T tolerance = std::is_same_v<T, float> ? T(1e-6) : T(1e-8);
+
+    std::vector<Q> a, b, out(203);
+    std::vector<T> t;
+    for (int i = 0; i < 203; ++i) {
+        Q qa = Q::fromEulerAngles(T(0.01) * T(i), T(0.3), T(-0.02) * T(i));
+        Q qb = Q::fromEulerAngles(T(0.5), T(0.013) * T(i), T(0.7) - T(0.01) * T(i));
+        a.push_back(qa);
+        b.push_back(i % 4 == 0 ? -qb : (i % 9 == 0 ? qa : qb));
+        t.push_back(T(i % 11) / T(10));
+    }
+
+    Q::slerp(a, b, t, out);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        Q e = Q::slerp(a[i], b[i], t[i]);
+        EXPECT_NEAR(out[i].w, e.w, tolerance) << i;
+        EXPECT_NEAR(out[i].x, e.x, tolerance) << i;
+        EXPECT_NEAR(out[i].y, e.y, tolerance) << i;
+        EXPECT_NEAR(out[i].z, e.z, tolerance) << i;
+    }
+
+    Q::nlerp(a, b, t, out);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        Q e = Q::nlerp(a[i], b[i], t[i]);
+        EXPECT_NEAR(out[i].w, e.w, tolerance) << i;
+        EXPECT_NEAR(out[i].z, e.z, tolerance) << i;
+    }
+}
+
+TYPED_TEST(QuaternionBlendTest, BatchSlerpClampsT) {
+    using T = TypeParam;
+    using Q = Quaternion<T>;
+    const T tolerance = std::is_same_v<T, float> ? T(1e-6) : T(1e-8);
+
+    const Q qa = Q::fromEulerAngles(T(0.2), T(-0.4), T(1.1));
+    const Q qb = Q::fromEulerAngles(T(-1.3), T(0.6), T(0.25));
+    const std::vector<T> t = {T(-3), T(-0.5), T(1.5), T(4)};
+    const std::vector<Q> a(t.size(), qa), b(t.size(), qb);
+    std::vector<Q> out(t.size());
+
+    Q::slerp(a, b, t, out);
+    for (std::size_t i = 0; i < t.size(); ++i) {
+        const Q e = Q::slerp(qa, qb, t[i] < T(0) ? T(0) : T(1));
+        EXPECT_NEAR(out[i].w, e.w, tolerance) << i;
+        EXPECT_NEAR(out[i].x, e.x, tolerance) << i;
+        EXPECT_NEAR(out[i].y, e.y, tolerance) << i;
+        EXPECT_NEAR(out[i].z, e.z, tolerance) << i;
+    }
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    template <typename T>
+    std::vector<typename SegmentIntersector<T>::Pair> brute(const std::vector<Line<T>>& lines) {
+        std::vector<typename SegmentIntersector<T>::Pair> pairs;
+        for (std::uint32_t a = 0; a < lines.size(); ++a)
+            for (std::uint32_t b = a + 1; b < lines.size(); ++b)
+                if (lines[a].intersects(lines[b]))
+                    pairs.push_back({a, b});
+        return pairs;
+    }
+}
+
+TEST(SegmentIntersectorTest, LineIntersects) {
+    const Linef a{{0.0, 0.0}, {4.0, 4.0}};
+    EXPECT_TRUE(a.intersects(Linef{{0.0, 4.0}, {4.0, 0.0}}));    // crossing
+    EXPECT_TRUE(a.intersects(Linef{{4.0, 4.0}, {6.0, 0.0}}));    // shared endpoint
+    EXPECT_TRUE(a.intersects(Linef{{2.0, 2.0}, {3.0, 0.0}}));    // T junction
+    EXPECT_TRUE(a.intersects(Linef{{3.0, 3.0}, {9.0, 9.0}}));    // collinear overlap
+    EXPECT_FALSE(a.intersects(Linef{{5.0, 5.0}, {9.0, 9.0}}));   // collinear, disjoint
+    EXPECT_FALSE(a.intersects(Linef{{0.0, 1.0}, {4.0, 5.0}}));   // parallel
+    EXPECT_FALSE(a.intersects(Linef{{3.0, 0.0}, {5.0, 1.0}}));   // would cross the supporting line only
+    EXPECT_TRUE(a.intersects(Linef{{1.0, 1.0}, {1.0, 1.0}}));    // point on the segment
+    EXPECT_FALSE(a.intersects(Linef{{1.0, 1.5}, {1.0, 1.5}}));
+
+    // an endpoint one ulp off the segment: exact predicates tell the sides apart
+    const Linef b{{0.1, 0.1}, {0.7, 0.3}};
+    const Vector2f mid{0.4, 0.2};
+    ASSERT_EQ(orient2d(b.p1, b.p2, mid), 0.0);
+    const Vector2f above{mid.x, std::nextafter(mid.y, 1.0)}, below{mid.x, std::nextafter(mid.y, 0.0)};
+    EXPECT_TRUE(b.intersects(Linef{mid, {0.4, 1.0}}));
+    EXPECT_FALSE(b.intersects(Linef{above, {0.4, 1.0}}));
+    EXPECT_TRUE(b.intersects(Linef{below, {0.4, 1.0}}));
+}
+
+TEST(SegmentIntersectorTest, MatchesBruteForce) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> pos(0.0, 100.0), angle(0.0, 6.283185307179586);
+    std::exponential_distribution<double> length(0.4);
+    std::vector<Linef> lines(3000);
+    for (auto& l : lines) {
+        const Vector2f p{pos(rng), pos(rng)};
+        const double a = angle(rng), r = length(rng);
+        l = {p, {p.x + r * std::cos(a), p.y + r * std::sin(a)}};
+    }
+    lines[10] = {{-5.0, 50.0}, {105.0, 50.0}};    // a few long ones crossing everything
+    lines[11] = {{50.0, -5.0}, {50.0, 105.0}};
+    lines[12] = {{0.0, 0.0}, {100.0, 100.0}};
+
+    SegmentIntersector<double> intersector;
+    const auto& pairs = intersector.update(lines);
+    EXPECT_EQ(pairs, brute(lines));
+    EXPECT_GT(pairs.size(), 100u);
+
+    // buffers are reused, an explicit cell size gives the same answer
+    SegmentIntersector<double> coarse(25.0);
+    EXPECT_EQ(coarse.update(lines), pairs);
+    lines.resize(1000);
+    EXPECT_EQ(intersector.update(lines), brute(lines));
+}
+
+TEST(SegmentIntersectorTest, Degenerate) {
+    // a lattice of unit edges: every edge touches its neighbours at shared vertices, all the
+    // vertices sit on cell borders
+    std::vector<Linei> lines;
+    for (int y = 0; y <= 20; ++y)
+        for (int x = 0; x <= 20; ++x) {
+            if (x < 20)
+                lines.push_back({{x, y}, {x + 1, y}});
+            if (y < 20)
+                lines.push_back({{x, y}, {x, y + 1}});
+        }
+    lines.push_back({{3, 3}, {3, 3}});     // point on a vertex
+    lines.push_back({{0, 0}, {20, 20}});   // diagonal through every vertex
+
+    SegmentIntersector<int> intersector;
+    EXPECT_EQ(intersector.update(lines), brute(lines));
+
+    SegmentIntersector<int> unit(1);
+    EXPECT_EQ(unit.update(lines), brute(lines));
+
+    EXPECT_TRUE(intersector.update(std::vector<Linei>{}).empty());
+    EXPECT_TRUE(intersector.update(std::vector<Linei>(1, Linei{{0, 0}, {1, 1}})).empty());
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+#include "common.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+    using Grid = SpatialGrid<double>;
+
+    std::vector<Grid::Index> bruteRadius(const std::vector<Vector2f>& points, Vector2f c, double r) {
+        std::vector<Grid::Index> found;
+        for (Grid::Index i = 0; i < points.size(); ++i)
+            if ((points[i] - c).square_magnitude() <= r * r)
+                found.push_back(i);
+        return found;
+    }
+
+    std::vector<Grid::Index> bruteNearest(const std::vector<Vector2f>& points, Vector2f c, std::size_t k) {
+        std::vector<Grid::Index> ids(points.size());
+        for (Grid::Index i = 0; i < ids.size(); ++i)
+            ids[i] = i;
+        std::sort(ids.begin(), ids.end(), [&](Grid::Index a, Grid::Index b) {
+            const double da = (points[a] - c).square_magnitude(), db = (points[b] - c).square_magnitude();
+            return da < db || (da == db && a < b);
+        });
+        ids.resize(std::min(k, ids.size()));
+        return ids;
+    }
+}
+
+TEST(SpatialGridTest, RadiusMatchesBruteForce) {
+    const auto points = test::points2(5000, 1, 0.0, 100.0);
+    Grid grid;
+    grid.rebuild(points);
+    EXPECT_EQ(grid.size(), points.size());
+
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> u(-10.0, 110.0), r(0.0, 8.0);
+    std::vector<Grid::Index> found;
+    for (int q = 0; q < 200; ++q) {
+        const Vector2f c{u(rng), u(rng)};
+        const double radius = r(rng);
+        found.clear();
+        grid.radius(c, radius, found);
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(found, bruteRadius(points, c, radius));
+    }
+}
+
+TEST(SpatialGridTest, NearestMatchesBruteForce) {
+    const auto points = test::points2(3000, 3, 0.0, 100.0);
+    Grid grid(2.5);
+    grid.rebuild(points);
+
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<double> u(-50.0, 150.0);
+    std::vector<Grid::Neighbor> out;
+    for (int q = 0; q < 200; ++q) {
+        const Vector2f c{u(rng), u(rng)};
+        const std::size_t k = std::size_t(q % 17);
+        grid.nearest(c, k, out);
+
+        const auto expected = bruteNearest(points, c, k);
+        ASSERT_EQ(out.size(), expected.size());
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            EXPECT_EQ(out[i].id, expected[i]);
+            EXPECT_EQ(out[i].distance2, (points[expected[i]] - c).square_magnitude());
+        }
+    }
+
+    grid.nearest({0.0, 0.0}, points.size() + 10, out);
+    EXPECT_EQ(out.size(), points.size());
+}
+
+TEST(SpatialGridTest, ParallelRebuildMatchesSerial) {
+    const auto points = test::points2(60000, 5, 0.0, 1000.0);
+    Grid serial, parallel;
+    serial.rebuild(points, 1);
+    parallel.rebuild(points, 4);
+
+    std::mt19937 rng(6);
+    std::uniform_real_distribution<double> u(0.0, 1000.0);
+    std::vector<Grid::Index> a, b;
+    std::vector<Grid::Neighbor> na, nb;
+    for (int q = 0; q < 100; ++q) {
+        const Vector2f c{u(rng), u(rng)};
+        a.clear();
+        b.clear();
+        serial.radius(c, 12.0, a);
+        parallel.radius(c, 12.0, b);
+        EXPECT_EQ(a, b);
+
+        serial.nearest(c, 8, na);
+        parallel.nearest(c, 8, nb);
+        ASSERT_EQ(na.size(), nb.size());
+        for (std::size_t i = 0; i < na.size(); ++i)
+            EXPECT_EQ(na[i].id, nb[i].id);
+    }
+}
+
+TEST(SpatialGridTest, Degenerate) {
+    Grid grid;
+    std::vector<Grid::Neighbor> out;
+    grid.rebuild(std::vector<Vector2f>{});
+    EXPECT_TRUE(grid.empty());
+    grid.nearest({1.0, 1.0}, 3, out);
+    EXPECT_TRUE(out.empty());
+
+    // all on one spot, then all on one line
+    std::vector<Vector2f> points(100, Vector2f{3.0, 3.0});
+    grid.rebuild(points);
+    std::vector<Grid::Index> found;
+    grid.radius({3.0, 3.0}, 0.0, found);
+    EXPECT_EQ(found.size(), points.size());
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+        points[i] = {double(i), 5.0};
+    grid.rebuild(points);
+    grid.nearest({41.2, 0.0}, 3, out);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(out[0].id, 41u);
+    EXPECT_EQ(out[1].id, 42u);
+    EXPECT_EQ(out[2].id, 40u);
+}
+
+TEST(SpatialGridTest, Integer) {
+    std::vector<Vector2<int>> points;
+    for (int y = -20; y <= 20; ++y)
+        for (int x = -20; x <= 20; ++x)
+            points.push_back({x, y});
+
+    SpatialGrid<int> grid(3);
+    grid.rebuild(points);
+
+    std::vector<SpatialGrid<int>::Index> found;
+    grid.radius({0, 0}, 2, found);
+    EXPECT_EQ(found.size(), 13u); // lattice points with x^2 + y^2 <= 4
+
+    std::vector<SpatialGrid<int>::Neighbor> out;
+    grid.nearest({20, 20}, 3, out);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(points[out[0].id].x, 20);
+    EXPECT_EQ(points[out[0].id].y, 20);
+    EXPECT_EQ(out[1].distance2, 1);
+    EXPECT_EQ(out[2].distance2, 1);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+    template <typename T>
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> bruteForce(const std::vector<Rect<T>>& rects, T margin) {
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+        for (std::uint32_t a = 0; a < rects.size(); ++a)
+            for (std::uint32_t b = a + 1; b < rects.size(); ++b)
+                if (rects[a].intersects(rects[b], margin))
+                    pairs.push_back({a, b});
+        return pairs;
+    }
+
+    template <typename T>
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> sorted(std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs) {
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    std::vector<Rectf> makeRects(std::size_t n, double spreadX, double spreadY, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> x(0.0, spreadX), y(0.0, spreadY), size(0.1, 2.0);
+        std::vector<Rectf> rects(n);
+        for (auto& r : rects)
+            r = {x(rng), y(rng), size(rng), size(rng)};
+        return rects;
+    }
+}
+
+TEST(SweepAndPruneTest, MatchesBruteForce) {
+    auto rects = makeRects(1500, 100.0, 60.0, 1);
+    SweepAndPrune<double> sap;
+
+    EXPECT_EQ(sorted<double>(sap.update(rects)), bruteForce(rects, 0.0));
+    EXPECT_EQ(sap.axis(), 0u);
+}
+
+TEST(SweepAndPruneTest, Margin) {
+    std::vector<Rectf> rects = {{0, 0, 2, 2}, {1.8, 0, 1, 1}, {0, 3, 2, 2}};
+    SweepAndPrune<double> sap;
+    EXPECT_TRUE(sap.update(rects).empty());
+
+    sap.setMargin(0.5);
+    EXPECT_EQ(sorted<double>(sap.update(rects)), bruteForce(rects, 0.5));
+    EXPECT_EQ(sap.pairs().size(), 1u);
+
+    auto many = makeRects(1000, 80.0, 80.0, 2);
+    sap.setMargin(0.75);
+    EXPECT_EQ(sorted<double>(sap.update(many)), bruteForce(many, 0.75));
+}
+
+// Touching rects: the boundary case has to round exactly like Rect::intersects.
+TEST(SweepAndPruneTest, Touching) {
+    std::vector<Rectf> rects;
+    for (int i = 0; i < 50; ++i)
+        rects.push_back({0.1 * i, 0.3 * (i % 3), 0.1, 0.3});
+
+    SweepAndPrune<double> sap(0.0);
+    EXPECT_EQ(sorted<double>(sap.update(rects)), bruteForce(rects, 0.0));
+}
+
+TEST(SweepAndPruneTest, TemporalCoherence) {
+    auto rects = makeRects(2000, 100.0, 100.0, 3);
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<double> step(-0.5, 0.5);
+    SweepAndPrune<double> sap(0.1);
+
+    for (int frame = 0; frame < 10; ++frame) {
+        for (auto& r : rects) {
+            r.x += step(rng);
+            r.y += step(rng);
+        }
+        ASSERT_EQ(sorted<double>(sap.update(rects)), bruteForce(rects, 0.1)) << frame;
+    }
+
+    // stretch along y: the sweep axis switches and the order is rebuilt
+    for (auto& r : rects)
+        r.y *= 10.0;
+    EXPECT_EQ(sorted<double>(sap.update(rects)), bruteForce(rects, 0.1));
+    EXPECT_EQ(sap.axis(), 1u);
+
+    rects.resize(500);
+    EXPECT_EQ(sorted<double>(sap.update(rects)), bruteForce(rects, 0.1));
+}
+
+TEST(SweepAndPruneTest, Integer) {
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> pos(-200, 200), size(1, 12);
+    std::vector<Recti> rects(800);
+    for (auto& r : rects)
+        r = {pos(rng), pos(rng), size(rng), size(rng)};
+
+    SweepAndPrune<int> sap(1);
+    EXPECT_EQ(sorted<int>(sap.update(rects)), bruteForce(rects, 1));
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+    using Chunk = std::pair<std::size_t, std::size_t>;
+
+    // chunks seen by parallel_for, sorted
+    std::vector<Chunk> chunks(ThreadPool& pool, std::size_t begin, std::size_t end, unsigned threads, std::size_t grain) {
+        std::mutex mutex;
+        std::vector<Chunk> seen;
+        pool.parallel_for(begin, end, [&](std::size_t first, std::size_t last) {
+            std::lock_guard<std::mutex> lock(mutex);
+            seen.emplace_back(first, last);
+        }, threads, grain);
+        std::sort(seen.begin(), seen.end());
+        return seen;
+    }
+}
+
+// ---------- parallel_for ----------
+TEST(ThreadPoolTest, EveryIndexOnce) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    for (std::size_t n : {0, 1, 63, 1000, 4097, 100000}) {
+        std::vector<std::uint8_t> visits(n + 10, 0);
+        pool.parallel_for(10, n + 10, [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i)
+                ++visits[i];
+        });
+        for (std::size_t i = 0; i < visits.size(); ++i)
+            ASSERT_EQ(visits[i], i < 10 ? 0 : 1) << "n " << n << " index " << i;
+    }
+}
+
+TEST(ThreadPoolTest, Chunks) {
+    ThreadPool pool(4);
+
+    // automatic grain: contiguous chunks, boundaries on multiples of 64 from begin
+    const auto automatic = chunks(pool, 5, 200005, 0, 0);
+    ASSERT_GT(automatic.size(), 4u);
+    EXPECT_EQ(automatic.front().first, 5u);
+    EXPECT_EQ(automatic.back().second, 200005u);
+    for (std::size_t k = 0; k < automatic.size(); ++k) {
+        EXPECT_EQ((automatic[k].first - 5) % 64, 0u);
+        if (k > 0) {
+            EXPECT_EQ(automatic[k].first, automatic[k - 1].second);
+        }
+    }
+
+    // explicit grain is used as is
+    const auto fixed = chunks(pool, 0, 1000, 3, 7);
+    ASSERT_EQ(fixed.size(), 143u);
+    for (std::size_t k = 0; k < fixed.size(); ++k) {
+        EXPECT_EQ(fixed[k].first, 7 * k);
+        EXPECT_EQ(fixed[k].second, std::min<std::size_t>(7 * k + 7, 1000));
+    }
+
+    // one thread or one chunk: a single inline call over the whole range
+    EXPECT_EQ(chunks(pool, 0, 100000, 1, 0), (std::vector<Chunk>{{0, 100000}}));
+    EXPECT_EQ(chunks(pool, 0, 500, 4, 0), (std::vector<Chunk>{{0, 500}}));
+}
+
+TEST(ThreadPoolTest, ThreadLimit) {
+    ThreadPool pool(6);
+    for (unsigned threads : {1u, 2u, 3u}) {
+        std::atomic<unsigned> active{0}, peak{0};
+        pool.parallel_for(0, 48, [&](std::size_t, std::size_t) {
+            const unsigned now = ++active;
+            unsigned seen = peak.load();
+            while (now > seen && !peak.compare_exchange_weak(seen, now))
+                ;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            --active;
+        }, threads, 1);
+        EXPECT_LE(peak.load(), threads);
+    }
+}
+
+TEST(ThreadPoolTest, Nested) {
+    ThreadPool pool(3);
+    std::vector<std::uint32_t> sums(64, 0);
+    pool.parallel_for(0, sums.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            std::atomic<std::uint32_t> sum{0};
+            pool.parallel_for(0, 5000, [&](std::size_t a, std::size_t b) {
+                std::uint32_t s = 0;
+                for (std::size_t j = a; j < b; ++j)
+                    s += std::uint32_t(j);
+                sum += s;
+            }, 0, 100);
+            sums[i] = sum;
+        }
+    }, 0, 1);
+    for (std::uint32_t s : sums)
+        EXPECT_EQ(s, 4999u * 5000u / 2u);
+}
+
+TEST(ThreadPoolTest, Exception) {
+    ThreadPool pool(4);
+    std::atomic<std::size_t> done{0};
+    EXPECT_THROW(pool.parallel_for(0, 1000, [&](std::size_t first, std::size_t last) {
+        if (first <= 500 && 500 < last)
+            throw std::runtime_error("chunk");
+        done += last - first;
+    }, 0, 10), std::runtime_error);
+    EXPECT_LT(done.load(), 1000u);
+
+    // still usable
+    std::atomic<std::size_t> count{0};
+    pool.parallel_for(0, 1000, [&](std::size_t first, std::size_t last) { count += last - first; }, 0, 10);
+    EXPECT_EQ(count.load(), 1000u);
+}
+
+// ---------- parallel_reduce ----------
+TEST(ThreadPoolTest, ReduceIsDeterministic) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> u(-1e6, 1e6);
+    std::vector<double> values(300000);
+    for (auto& v : values)
+        v = u(rng) * std::pow(10.0, double(rng() % 12) - 6.0);
+
+    auto sum = [&](std::size_t first, std::size_t last) {
+        return std::accumulate(values.begin() + std::ptrdiff_t(first), values.begin() + std::ptrdiff_t(last), 0.0);
+    };
+    auto plus = [](double a, double b) { return a + b; };
+
+    // chunks of 4096 summed in order
+    double expected = 0.0;
+    for (std::size_t first = 0; first < values.size(); first += 4096)
+        expected += sum(first, std::min(values.size(), first + 4096));
+
+    ThreadPool pool(5);
+    for (unsigned threads : {1u, 2u, 5u})
+        EXPECT_EQ(pool.parallel_reduce(0, values.size(), 0.0, sum, plus, threads, 4096), expected);
+    EXPECT_EQ(parallel_reduce(0, values.size(), 0.0, sum, plus, 1, 4096), expected);
+    EXPECT_EQ(parallel_reduce(0, values.size(), 0.0, sum, plus, 3, 4096), expected);
+
+    // identity, empty range, non commutative combine in chunk order
+    EXPECT_EQ(pool.parallel_reduce(0, 0, 42.0, sum, plus), 42.0);
+    const auto order = pool.parallel_reduce(0, 1000, std::vector<std::size_t>{},
+        [](std::size_t first, std::size_t) { return std::vector<std::size_t>{first}; },
+        [](std::vector<std::size_t> a, const std::vector<std::size_t>& b) { a.insert(a.end(), b.begin(), b.end()); return a; },
+        4, 100);
+    ASSERT_EQ(order.size(), 10u);
+    for (std::size_t k = 0; k < order.size(); ++k)
+        EXPECT_EQ(order[k], 100 * k);
+}
+
+TEST(ThreadPoolTest, ReduceBool) {
+    // one bool per chunk: neighbouring partials are written by different threads at once
+    std::vector<std::uint8_t> flags(100000, 0);
+    flags[77777] = 1;
+    auto any = [&](std::size_t first, std::size_t last) {
+        return std::any_of(flags.begin() + std::ptrdiff_t(first), flags.begin() + std::ptrdiff_t(last), [](std::uint8_t f) { return f != 0; });
+    };
+    auto none = [&](std::size_t first, std::size_t last) { return !any(first, last); };
+    auto either = [](bool a, bool b) { return a || b; };
+    auto both = [](bool a, bool b) { return a && b; };
+
+    ThreadPool pool(4);
+    for (unsigned threads : {2u, 4u}) {
+        EXPECT_TRUE(pool.parallel_reduce(0, flags.size(), false, any, either, threads, 16));
+        EXPECT_FALSE(pool.parallel_reduce(0, 77777, false, any, either, threads, 16));
+        EXPECT_FALSE(pool.parallel_reduce(0, flags.size(), true, none, both, threads, 16));
+        EXPECT_TRUE(pool.parallel_reduce(77778, flags.size(), true, none, both, threads, 16));
+    }
+}
+
+// ---------- SIMD kernels split across threads ----------
+TEST(ThreadPoolTest, SplitKernel) {
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> u(-10.0, 10.0);
+    std::vector<Vector3f> points(100003);
+    for (auto& p : points)
+        p = {u(rng), u(rng), u(rng)};
+    const Matrix4x4 m = Quaterniond::fromEulerAngles(0.3, -0.4, 1.2).toMatrix();
+
+    std::vector<Vector3f> serial(points.size()), split(points.size());
+    transformPoints(m, std::span<const Vector3f>(points), std::span<Vector3f>(serial));
+    parallel_for(0, points.size(), [&](std::size_t first, std::size_t last) {
+        transformPoints(m, std::span<const Vector3f>(points).subspan(first, last - first),
+                        std::span<Vector3f>(split).subspan(first, last - first));
+    }, 4);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        ASSERT_EQ(split[i], serial[i]) << i;
+}
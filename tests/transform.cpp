@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <vector>
+
+namespace {
+    Matrix4x4 makeAffine() {
+        Matrix4x4 m{{
+            {0.0, -1.0, 0.0, 10.0},
+            {1.0,  0.0, 0.0, 20.0},
+            {0.0,  0.0, 2.0, 30.0},
+            {0.0,  0.0, 0.0,  1.0}
+        }};
+        return m;
+    }
+
+    std::vector<Vector3f> makePoints(std::size_t n) {
+        std::vector<Vector3f> points(n);
+        for (std::size_t i = 0; i < n; ++i)
+            points[i] = {double(i) * 0.25, 1.0 - double(i % 5), double(i) / 7.0};
+        return points;
+    }
+}
+
+// ---------- Single vector ----------
+TEST(TransformTest, AffinePoint) {
+    Matrix4x4 m = makeAffine();
+    ASSERT_TRUE(isAffine(m));
+
+    Vector3f p = transformPoint(m, Vector3f{1, 2, 3});
+    EXPECT_DOUBLE_EQ(p.x, 8.0);
+    EXPECT_DOUBLE_EQ(p.y, 21.0);
+    EXPECT_DOUBLE_EQ(p.z, 36.0);
+
+    Vector3f d = transformDirection(m, Vector3f{1, 2, 3});
+    EXPECT_DOUBLE_EQ(d.x, -2.0);
+    EXPECT_DOUBLE_EQ(d.y, 1.0);
+    EXPECT_DOUBLE_EQ(d.z, 6.0);
+}
+
+TEST(TransformTest, ProjectivePoint) {
+    Matrix4x4 m = Matrix4x4::identity();
+    m(3, 2) = 1; // w = z
+    m(3, 3) = 0;
+    ASSERT_FALSE(isAffine(m));
+
+    Vector3f p = transformPoint(m, Vector3f{2, 4, 2});
+    EXPECT_DOUBLE_EQ(p.x, 1.0);
+    EXPECT_DOUBLE_EQ(p.y, 2.0);
+    EXPECT_DOUBLE_EQ(p.z, 1.0);
+}
+
+// ---------- Batches ----------
+TEST(TransformTest, BatchMatchesSingle) {
+    Matrix4x4 affine = makeAffine();
+    Matrix4x4 projective = affine;
+    projective(3, 0) = 0.5;
+    projective(3, 3) = 2.0;
+
+    auto points = makePoints(515);
+    std::vector<Vector3f> out(points.size());
+
+    for (const Matrix4x4& m : {affine, projective}) {
+        transformPoints(m, points, out);
+        for (std::size_t i = 0; i < points.size(); ++i)
+            EXPECT_EQ(out[i], transformPoint(m, points[i]));
+
+        transformDirections(m, points, out);
+        for (std::size_t i = 0; i < points.size(); ++i)
+            EXPECT_EQ(out[i], transformDirection(m, points[i]));
+    }
+}
+
+TEST(TransformTest, InPlaceAndSoA) {
+    Matrix4x4 m = makeAffine();
+    auto points = makePoints(33);
+    auto expected = points;
+    for (auto& p : expected)
+        p = transformPoint(m, p);
+
+    Vector3Array<double> soa(points), soaOut;
+    transformPoints(m, soa, soaOut);
+
+    transformPoints(m, points, points);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(points[i], expected[i]);
+        EXPECT_EQ(soaOut[i], expected[i]);
+    }
+}
+
+TEST(TransformTest, Homogeneous) {
+    Matrix4x4 m = makeAffine();
+    std::vector<Vector4f> in = {{1, 1, 2, 3}, {0, 1, 0, 0}, {2, -1, 5, 0.5}};
+    std::vector<Vector4f> out(in.size());
+
+    transform(m, in, out);
+    for (std::size_t i = 0; i < in.size(); ++i)
+        EXPECT_TRUE(out[i].same(m * in[i]));
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    using Hierarchy = TransformHierarchy<double>;
+
+    Quaterniond randomRotation(std::mt19937& rng) {
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        Quaterniond q(u(rng), u(rng), u(rng), u(rng));
+        q.normalize();
+        return q;
+    }
+
+    Vector3f randomVector(std::mt19937& rng, double lo, double hi) {
+        std::uniform_real_distribution<double> u(lo, hi);
+        return {u(rng), u(rng), u(rng)};
+    }
+
+    // depth first: the parent is the last node or one of its ancestors
+    Hierarchy makeDepthFirst(std::size_t n, unsigned seed) {
+        std::mt19937 rng(seed);
+        Hierarchy h;
+        std::vector<Hierarchy::Index> path;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (rng() % 20000 == 0)
+                path.clear();
+            else if (!path.empty())
+                path.resize(path.size() - std::min<std::size_t>(path.size() - 1, rng() % 3));
+            const Hierarchy::Index parent = path.empty() ? Hierarchy::none : path.back();
+            path.push_back(h.add(parent, randomRotation(rng), randomVector(rng, -2.0, 2.0), randomVector(rng, 0.5, 1.5)));
+        }
+        return h;
+    }
+
+    // world matrices recomputed from scratch
+    std::vector<Matrix4x4> expectedWorld(const Hierarchy& h) {
+        std::vector<Matrix4x4> world(h.size());
+        for (Hierarchy::Index i = 0; i < h.size(); ++i)
+            world[i] = h.parent(i) == Hierarchy::none ? h.local(i) : world[h.parent(i)] * h.local(i);
+        return world;
+    }
+
+    void expectWorld(const Hierarchy& h) {
+        const auto expected = expectedWorld(h);
+        for (Hierarchy::Index i = 0; i < h.size(); ++i) {
+            for (std::size_t r = 0; r < 4; ++r) {
+                for (std::size_t c = 0; c < 4; ++c)
+                    ASSERT_EQ(h.world(i)(r, c), expected[i](r, c)) << "node " << i;
+            }
+        }
+    }
+}
+
+TEST(TransformHierarchyTest, LocalAndWorld) {
+    Hierarchy h;
+    const auto root = h.add(Hierarchy::none, Quaterniond::fromAxisAngle(M_PI / 2, {0, 0, 1}), {1, 0, 0}, {2, 2, 2});
+    const auto child = h.add(root, {}, {1, 0, 0});
+    EXPECT_TRUE(h.dirty());
+    h.update();
+    EXPECT_FALSE(h.dirty());
+
+    // child origin: scaled by 2, rotated onto +y, translated by (1, 0, 0)
+    const Vector3f p = transformPoint(h.world(child), Vector3f{0, 0, 0});
+    EXPECT_NEAR(p.x, 1.0, 1e-12);
+    EXPECT_NEAR(p.y, 2.0, 1e-12);
+    EXPECT_NEAR(p.z, 0.0, 1e-12);
+    expectWorld(h);
+}
+
+TEST(TransformHierarchyTest, OnlyChangedSubtrees) {
+    auto h = makeDepthFirst(5000, 1);
+    EXPECT_TRUE(h.depthFirst());
+    h.update(1);
+    expectWorld(h);
+
+    // a node outside the changed subtree keeps its (stale on purpose) matrix
+    std::mt19937 rng(2);
+    const Hierarchy::Index changed = 2500;
+    Hierarchy::Index sibling = Hierarchy::none;
+    for (Hierarchy::Index i = changed + 1; i < h.size() && sibling == Hierarchy::none; ++i) {
+        Hierarchy::Index a = i;
+        while (a != Hierarchy::none && a != changed)
+            a = h.parent(a);
+        if (a == Hierarchy::none)
+            sibling = i;
+    }
+    ASSERT_NE(sibling, Hierarchy::none);
+
+    const Matrix4x4 before = h.world(sibling);
+    h.setTranslation(changed, {5, 6, 7});
+    h.setRotation(changed, randomRotation(rng));
+    h.update(1);
+    expectWorld(h);
+    for (std::size_t r = 0; r < 4; ++r) {
+        for (std::size_t c = 0; c < 4; ++c)
+            EXPECT_EQ(h.world(sibling)(r, c), before(r, c));
+    }
+
+    // no change, no work
+    h.update(1);
+    EXPECT_FALSE(h.dirty());
+    expectWorld(h);
+}
+
+TEST(TransformHierarchyTest, Threads) {
+    auto single = makeDepthFirst(60000, 3);
+    auto threaded = makeDepthFirst(60000, 3);
+    single.update(1);
+    threaded.update(4);
+    for (Hierarchy::Index i = 0; i < single.size(); ++i) {
+        for (std::size_t r = 0; r < 4; ++r) {
+            for (std::size_t c = 0; c < 4; ++c)
+                ASSERT_EQ(threaded.world(i)(r, c), single.world(i)(r, c));
+        }
+    }
+
+    std::mt19937 rng(4);
+    for (int round = 0; round < 3; ++round) {
+        for (int k = 0; k < 50; ++k)
+            threaded.setScale(Hierarchy::Index(rng() % threaded.size()), randomVector(rng, 0.5, 1.5));
+        if (round == 0)
+            threaded.setRotation(0, randomRotation(rng));
+        threaded.update(3 + unsigned(round));
+        expectWorld(threaded);
+    }
+}
+
+TEST(TransformHierarchyTest, SortDepthFirst) {
+    // children appended after unrelated nodes: correct, but not depth first
+    std::mt19937 rng(5);
+    Hierarchy h;
+    for (std::size_t i = 0; i < 3000; ++i) {
+        const Hierarchy::Index parent = i < 4 || rng() % 5 == 0 ? Hierarchy::none : Hierarchy::Index(rng() % i);
+        h.add(parent, randomRotation(rng), randomVector(rng, -1.0, 1.0), randomVector(rng, 0.9, 1.1));
+    }
+    EXPECT_FALSE(h.depthFirst());
+    h.update(4);
+    expectWorld(h);
+    const auto original = expectedWorld(h);
+
+    const auto remap = h.sortDepthFirst();
+    EXPECT_TRUE(h.depthFirst());
+    ASSERT_EQ(remap.size(), h.size());
+    for (Hierarchy::Index i = 0; i < h.size(); ++i) {
+        if (h.parent(i) != Hierarchy::none) {
+            EXPECT_LT(h.parent(i), i);
+        }
+        EXPECT_EQ(h.world(remap[i])(0, 3), original[i](0, 3));
+    }
+    EXPECT_FALSE(h.dirty());
+
+    h.setTranslation(remap[0], {1, 2, 3});
+    h.update(4);
+    expectWorld(h);
+
+    // appends stay depth first under the last node's path
+    const Hierarchy::Index last = Hierarchy::Index(h.size() - 1);
+    h.add(h.add(last), {}, {1, 0, 0});
+    h.add(h.parent(last));
+    EXPECT_TRUE(h.depthFirst());
+    h.setScale(remap[0], {2, 2, 2});
+    h.update(4);
+    expectWorld(h);
+}
+
+TEST(TransformHierarchyTest, DeepChain) {
+    std::mt19937 rng(6);
+    Hierarchy h;
+    Hierarchy::Index parent = Hierarchy::none;
+    for (std::size_t i = 0; i < 200000; ++i)
+        parent = h.add(parent, randomRotation(rng), randomVector(rng, -0.01, 0.01));
+    h.update(1);
+
+    // branch halfway down the chain, the lower half of the chain is closed
+    h.add(Hierarchy::Index(100000), {}, {0, 1, 0});
+    EXPECT_TRUE(h.depthFirst());
+    h.setTranslation(150000, {0, 0, 1});
+    h.setTranslation(90000, {1, 0, 0});
+    h.update(4);
+    expectWorld(h);
+
+    h.add(Hierarchy::Index(150000));
+    EXPECT_FALSE(h.depthFirst());
+}
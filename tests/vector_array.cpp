@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "Type.hpp"
+
+#include <vector>
+
+namespace {
+    std::vector<Vector3f> makeVectors(std::size_t n) {
+        std::vector<Vector3f> v(n);
+        for (std::size_t i = 0; i < n; ++i)
+            v[i] = {double(i) * 0.5 - 3.0, double(i % 7) - 2.0, 1.0 / double(i + 1)};
+        v[n / 2] = {0, 0, 0};
+        return v;
+    }
+}
+
+// ---------- Vector3Array ----------
+TEST(Vector3ArrayTest, GatherScatterRoundTrip) {
+    auto vectors = makeVectors(37);
+    Vector3Array<double> array(vectors);
+    ASSERT_EQ(array.size(), vectors.size());
+
+    std::vector<Vector3f> back(vectors.size());
+    array.scatter(back);
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        EXPECT_EQ(back[i], vectors[i]);
+        EXPECT_EQ(array[i], vectors[i]);
+    }
+}
+
+TEST(Vector3ArrayTest, KernelsMatchScalar) {
+    auto a = makeVectors(37);
+    auto b = makeVectors(40);
+    b.resize(a.size());
+    Vector3Array<double> sa(a), sb(b);
+
+    std::vector<double> dot(a.size()), len(a.size()), dist(a.size());
+    Vector3Array<double> cross, normalized;
+    sa.dot(sb, dot);
+    sa.magnitude(len);
+    sa.distance(sb, dist);
+    sa.cross(sb, cross);
+    sa.normalized(normalized);
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(dot[i], a[i].dot(b[i]));
+        EXPECT_EQ(len[i], a[i].magnitude());
+        EXPECT_EQ(dist[i], a[i].distance(b[i]));
+        EXPECT_EQ(cross[i], a[i].cross(b[i]));
+        EXPECT_EQ(normalized[i], a[i].normalized());
+    }
+}
+
+TEST(Vector3ArrayTest, ShortestSize) {
+    const auto a = makeVectors(37);
+    const auto b = makeVectors(21);
+    Vector3Array<double> sa(a), sb(b);
+
+    // outputs past the shortest size are left untouched
+    std::vector<double> dot(40, -1.0), dist(13, -1.0), len(20, -1.0);
+    sa.dot(sb, dot);
+    sb.distance(sa, dist);
+    sa.magnitude(len);
+    for (std::size_t i = 0; i < dot.size(); ++i) {
+        EXPECT_EQ(dot[i], i < 21 ? a[i].dot(b[i]) : -1.0);
+    }
+    for (std::size_t i = 0; i < dist.size(); ++i) {
+        EXPECT_EQ(dist[i], b[i].distance(a[i]));
+    }
+    for (std::size_t i = 0; i < len.size(); ++i) {
+        EXPECT_EQ(len[i], a[i].magnitude());
+    }
+
+    Vector3Array<double> cross;
+    sa.cross(sb, cross);
+    ASSERT_EQ(cross.size(), 21u);
+
+    std::vector<Vector3f> back(5);
+    sa.scatter(back);
+    for (std::size_t i = 0; i < back.size(); ++i) {
+        EXPECT_EQ(back[i], a[i]);
+    }
+}
+
+TEST(Vector3ArrayTest, FloatLanes) {
+    std::vector<Vector3<float>> v;
+    for (int i = 0; i < 19; ++i)
+        v.push_back({float(i), 2.0f, -1.0f});
+    Vector3Array<float> array(v);
+
+    array.normalize();
+    std::vector<float> len(v.size());
+    array.magnitude(len);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        EXPECT_EQ(array[i], v[i].normalized());
+        EXPECT_NEAR(len[i], 1.0f, epsilonf);
+    }
+}
+
+// ---------- Vector2Array / Vector4Array ----------
+TEST(Vector2ArrayTest, Dot) {
+    Vector2Array<int> array;
+    array.push_back({1, 2});
+    array.push_back({3, 4});
+
+    std::vector<int> dot(2);
+    array.dot(array, dot);
+    EXPECT_EQ(dot[0], 5);
+    EXPECT_EQ(dot[1], 25);
+}
+
+TEST(Vector4ArrayTest, LaneOrderFollowsMembers) {
+    Vector4Array<double> array;
+    array.push_back({1, 2, 3, 4});
+    EXPECT_DOUBLE_EQ(array.lane(0)[0], 1.0); // w
+    EXPECT_DOUBLE_EQ(array.lane(3)[0], 4.0); // z
+
+    std::vector<double> len(1);
+    array.magnitude(len);
+    Vector4f reference{1, 2, 3, 4};
+    EXPECT_DOUBLE_EQ(len[0], reference.magnitude());
+}